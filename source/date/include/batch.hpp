@@ -0,0 +1,75 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "format.hpp"
+#include "timeZone.hpp"
+
+/**
+ * @class Batch
+ * @brief Converts a stream of epoch values into formatted dates, or formatted dates back into epoch values.
+ *
+ * The input holds one value per line, in seconds since the Epoch (e.g. `1735689600`, `-86400`), or one
+ * formatted date per line in the reverse direction. Each one is converted with the same compiled format
+ * and followed by a newline.
+ *
+ * The whole batch reuses the same state and a single output buffer: the input is read and the output
+ * written in large blocks, so converting millions of values costs a handful of system calls.
+ */
+class Batch
+{
+public:
+    /**
+     * @brief Formats every epoch value read from a file descriptor and writes the results to another.
+     *
+     * Lines that don't hold a valid value are reported on the standard error and skipped.
+     *
+     * @param input The file descriptor the values are read from.
+     * @param output The file descriptor the formatted dates are written to.
+     * @param program The compiled format, see `Parser::CompileFormat()`.
+     * @param isUtc If true, the values are broken down in UTC; otherwise, in local time.
+     * @return True if every line held a valid value and everything was written, false otherwise.
+     */
+    static auto FormatEpochs(int, int, const FormatProgram&, bool) -> bool;
+
+    /**
+     * @brief Reads every formatted date read from a file descriptor back into its epoch value.
+     *
+     * Each line is read with `Parser::ScanFormat()`, or with the fast path `Parser::ScanIso8601()` when
+     * the format is an ISO 8601 layout. Each value is written in seconds since the Epoch, followed by the
+     * nanoseconds (e.g. `1751632245.250000000`) when the date has a fraction. Lines that don't hold a valid
+     * date are reported on the standard error and skipped.
+     *
+     * @param input The file descriptor the dates are read from.
+     * @param output The file descriptor the epoch values are written to.
+     * @param program The compiled format of the dates, see `Parser::CompileFormat()`.
+     * @param zone The zone the dates are local times of, unless they say otherwise.
+     * @return True if every line held a valid date and everything was written, false otherwise.
+     */
+    static auto ScanDates(int, int, const FormatProgram&, const TimeZone&) -> bool;
+};
@@ -0,0 +1,240 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "snapshot.hpp"
+
+/**
+ * @brief Number of seconds in a day.
+ */
+inline constexpr std::int64_t SECONDS_PER_DAY = 86400;
+
+/**
+ * @brief A date of the proleptic Gregorian calendar.
+ */
+struct CivilDate
+{
+    std::int64_t year = 1970; // Full year (e.g., 2025), may be negative
+    unsigned month    = 1;    // Month (1 = January, 12 = December)
+    unsigned day      = 1;    // Day of the month (1–31)
+};
+
+/**
+ * @brief Checks whether a year of the proleptic Gregorian calendar is a leap year.
+ *
+ * @param year The full year (e.g., 2024).
+ * @return True if February has 29 days that year, false otherwise.
+ */
+constexpr auto isLeapYear(std::int64_t year) -> bool
+{
+    return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+}
+
+/**
+ * @brief Returns the number of days of a month.
+ *
+ * @param year The full year (e.g., 2024).
+ * @param month The month (1 = January, 12 = December).
+ * @return The number of days of the month (28–31).
+ */
+constexpr auto daysInMonth(std::int64_t year, unsigned month) -> unsigned
+{
+    // Months alternate between 31 and 30 days, the alternation restarting in August
+    return month == 2 ? (isLeapYear(year) ? 29 : 28) : 30 + ((month + month / 8) & 1);
+}
+
+/**
+ * @brief Returns the number of days between the Epoch (1970-01-01) and a date.
+ *
+ * This is pure arithmetic on 400-year eras, without any table, branch on the month or call to the C
+ * library, so it can be evaluated at compile time and used from any number of threads. The day is
+ * used linearly: day 0 is the last day of the previous month, day 32 spills over the next one.
+ *
+ * @param year The full year (e.g., 2025).
+ * @param month The month (1 = January, 12 = December).
+ * @param day The day of the month.
+ * @return The number of days since the Epoch, negative before it.
+ */
+constexpr auto daysFromCivil(std::int64_t year, unsigned month, int day) -> std::int64_t
+{
+    // The year is shifted to begin in March, so the leap day is the last one of the year
+    year -= month <= 2 ? 1 : 0;
+
+    const std::int64_t era      = (year >= 0 ? year : year - 399) / 400;             // 400-year era of the year
+    const auto yearOfEra        = static_cast<unsigned>(year - era * 400);           // [0, 399]
+    const unsigned shiftedMonth = month > 2 ? month - 3 : month + 9;                 // [0, 11], March = 0
+    const unsigned startOfMonth = (153 * shiftedMonth + 2) / 5;                      // [0, 337], day of the year of the 1st
+    const unsigned startOfYear  = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100; // [0, 145731], day of the era of March 1st
+
+    return era * 146097 + startOfYear + startOfMonth + day - 1 - 719468;
+}
+
+/**
+ * @brief Returns the date a given number of days after the Epoch (1970-01-01).
+ *
+ * This is the inverse of `daysFromCivil()`, and is just as free of tables, locks and allocations.
+ *
+ * @param days The number of days since the Epoch, negative before it.
+ * @return The corresponding date.
+ */
+constexpr auto civilFromDays(std::int64_t days) -> CivilDate
+{
+    days += 719468;
+
+    const std::int64_t era      = (days >= 0 ? days : days - 146096) / 146097;                                // 400-year era of the day
+    const auto dayOfEra         = static_cast<unsigned>(days - era * 146097);                                 // [0, 146096]
+    const unsigned yearOfEra    = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365; // [0, 399]
+    const unsigned dayOfYear    = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);            // [0, 365]
+    const unsigned shiftedMonth = (5 * dayOfYear + 2) / 153;                                                 // [0, 11], March = 0
+    CivilDate date;                                                                                           // Date being computed
+
+    date.day   = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1;
+    date.month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+    date.year  = static_cast<std::int64_t>(yearOfEra) + era * 400 + (date.month <= 2 ? 1 : 0);
+
+    return date;
+}
+
+/**
+ * @brief Returns the day of the week a given number of days after the Epoch.
+ *
+ * @param days The number of days since the Epoch, negative before it.
+ * @return The day of the week (0 = Sunday, 6 = Saturday).
+ */
+constexpr auto weekdayFromDays(std::int64_t days) -> unsigned
+{
+    // The Epoch was a Thursday
+    return static_cast<unsigned>(days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6);
+}
+
+/**
+ * @brief Returns the number of seconds between the Epoch and a date and time.
+ *
+ * As with `daysFromCivil()`, out of range times spill over the next fields (e.g. 24:00 is midnight the
+ * next day). No time zone is involved: to get an instant from a local time, the UTC offset of the
+ * zone must be subtracted from the result.
+ *
+ * @param year The full year (e.g., 2025).
+ * @param month The month (1 = January, 12 = December).
+ * @param day The day of the month.
+ * @param hour The hour.
+ * @param minute The minute.
+ * @param second The second.
+ * @return The number of seconds since the Epoch, negative before it.
+ */
+constexpr auto secondsFromCivil(std::int64_t year, unsigned month, int day, int hour, int minute, int second) -> std::int64_t
+{
+    return daysFromCivil(year, month, day) * SECONDS_PER_DAY + hour * std::int64_t{3600} + minute * std::int64_t{60} + second;
+}
+
+/**
+ * @brief Breaks a number of seconds since the Epoch down into date and time fields.
+ *
+ * The seconds are taken as they are: for local time, the UTC offset of the zone must be added first.
+ * The time zone of the snapshot is left empty.
+ *
+ * @param seconds The number of seconds since the Epoch, negative before it.
+ * @return The broken-down fields, with the month counted from 0 as in ClockInterface.
+ */
+constexpr auto breakDown(std::int64_t seconds) -> Snapshot
+{
+    std::int64_t days        = seconds / SECONDS_PER_DAY; // Whole days since the Epoch, rounded down below
+    std::int64_t secondOfDay = seconds % SECONDS_PER_DAY; // [0, 86399] once rounded down
+    Snapshot snapshot;                                    // Fields being computed
+
+    if (secondOfDay < 0)
+    {
+        secondOfDay += SECONDS_PER_DAY;
+        days--;
+    }
+
+    const CivilDate date = civilFromDays(days);
+
+    snapshot.year         = static_cast<int>(date.year);
+    snapshot.month        = static_cast<int>(date.month) - 1;
+    snapshot.day          = static_cast<int>(date.day);
+    snapshot.hour         = static_cast<int>(secondOfDay / 3600);
+    snapshot.minute       = static_cast<int>(secondOfDay / 60 % 60);
+    snapshot.second       = static_cast<int>(secondOfDay % 60);
+    snapshot.dayOfTheWeek = static_cast<int>(weekdayFromDays(days));
+
+    return snapshot;
+}
+
+/**
+ * @brief Moves broken-down fields by an offset, without breaking the instant down again.
+ *
+ * This turns the UTC fields of an instant into the local fields of any zone: only the time of the day
+ * is computed again, and the date is only moved when the offset crosses midnight. The time zone of the
+ * snapshot is left empty.
+ *
+ * @param fields The broken-down fields, see `breakDown()`.
+ * @param offset The offset to add, in seconds.
+ * @return The fields of the instant `offset` seconds later.
+ */
+constexpr auto shiftBreakDown(const Snapshot& fields, std::int64_t offset) -> Snapshot
+{
+    std::int64_t secondOfDay = fields.hour * std::int64_t{3600} + fields.minute * std::int64_t{60} + fields.second + offset; // May be out of the day
+    std::int64_t days        = secondOfDay / SECONDS_PER_DAY;                                                               // Whole days moved, rounded down below
+    Snapshot snapshot        = fields;                                                                                      // Fields being computed
+
+    secondOfDay %= SECONDS_PER_DAY;
+
+    if (secondOfDay < 0)
+    {
+        secondOfDay += SECONDS_PER_DAY;
+        days--;
+    }
+
+    snapshot.hour     = static_cast<int>(secondOfDay / 3600);
+    snapshot.minute   = static_cast<int>(secondOfDay / 60 % 60);
+    snapshot.second   = static_cast<int>(secondOfDay % 60);
+    snapshot.timeZone = {};
+
+    if (days != 0)
+    {
+        const std::int64_t day = daysFromCivil(fields.year, static_cast<unsigned>(fields.month) + 1, fields.day) + days;
+        const CivilDate date   = civilFromDays(day);
+
+        snapshot.year         = static_cast<int>(date.year);
+        snapshot.month        = static_cast<int>(date.month) - 1;
+        snapshot.day          = static_cast<int>(date.day);
+        snapshot.dayOfTheWeek = static_cast<int>(weekdayFromDays(day));
+    }
+
+    return snapshot;
+}
+
+static_assert(daysFromCivil(1970, 1, 1) == 0, "The Epoch is day 0");
+static_assert(daysFromCivil(2000, 3, 1) == 11017, "2000-03-01 follows a leap day");
+static_assert(daysFromCivil(2000, 3, 0) == daysFromCivil(2000, 2, 29), "Day 0 is the last day of the previous month");
+static_assert(civilFromDays(-1).year == 1969 && civilFromDays(-1).month == 12 && civilFromDays(-1).day == 31, "The day before the Epoch");
+static_assert(daysInMonth(2024, 2) == 29 && daysInMonth(1900, 2) == 28 && daysInMonth(2025, 7) == 31 && daysInMonth(2025, 9) == 30, "Month lengths");
+static_assert(weekdayFromDays(0) == 4 && weekdayFromDays(-1) == 3 && weekdayFromDays(-5) == 6, "The Epoch was a Thursday");
+static_assert(breakDown(-1).second == 59 && breakDown(-1).hour == 23, "Negative seconds are rounded down");
+static_assert(shiftBreakDown(breakDown(0), -1).year == 1969 && shiftBreakDown(breakDown(1709164800), 86400 + 3600).month == 2, "Offsets move the date across days");
@@ -30,6 +30,8 @@
 #include "clockInterface.hpp"
 #include "day.hpp"
 #include "month.hpp"
+#include "snapshot.hpp"
+#include "timeZone.hpp"
 
 /**
  * @class Clock
@@ -42,12 +44,12 @@
 class Clock : public ClockInterface
 {
 private:
-    time_t now;                               // Stores the current time as time_t
-    tm* time;                                 // Pointer to a tm structure that will hold broken-down time
-    Day day;                                  // Enum value representing a specific day, initialized to default (0)
-    Month month;                              // Enum value representing a specific month, initialized to default (0)
-    static constexpr int TM_YEAR_BASE = 1900; // Base for calculating date
-    std::string timeZone;                     // String representing the timezone
+    time_t now;           // Stores the current time as time_t
+    Snapshot fields;      // Broken-down time, owned by the clock so it can be reused for another instant
+    const TimeZone* zone; // Zone the time is broken down in, UTC or the local one
+    ZonePeriod period;    // Period of the zone holding the last instant, reused while the instants stay in it
+    Day day;              // Enum value representing a specific day, initialized to default (0)
+    Month month;          // Enum value representing a specific month, initialized to default (0)
 
 public:
     /**
@@ -58,10 +60,55 @@ public:
     /**
      * @brief Constructs the Clock object using either local time or UTC.
      *
+     * The current time is read with its nanoseconds, see `readTime()`.
+     *
      * @param isUtc If true, initializes the clock to UTC time; otherwise, uses local time.
      */
     explicit Clock(bool isUtc);
 
+    /**
+     * @brief Constructs the Clock object for a given instant, using either local time or UTC.
+     *
+     * @param instant The instant, in seconds since the Epoch.
+     * @param isUtc If true, breaks the instant down in UTC; otherwise, uses local time.
+     */
+    Clock(time_t instant, bool isUtc);
+
+    /**
+     * @brief Constructs the Clock object for a given instant, in a given zone.
+     *
+     * @param instant The instant, in seconds since the Epoch.
+     * @param zone The zone the instant is broken down in. It must outlive the clock.
+     */
+    Clock(time_t instant, const TimeZone& zone);
+
+    /**
+     * @brief Constructs the Clock object for a given instant with its nanoseconds, in a given zone.
+     *
+     * @param instant The instant, in seconds and nanoseconds since the Epoch.
+     * @param zone The zone the instant is broken down in. It must outlive the clock.
+     */
+    Clock(timespec instant, const TimeZone& zone);
+
+    /**
+     * @brief Moves the clock to another instant, keeping its local time or UTC setting.
+     *
+     * The broken-down time is computed again in place, so a single Clock can format any number of instants.
+     * The fields come from the calendar engine of calendar.hpp rather than from the C library, so no lock
+     * is taken and nothing is shared between clocks. The zone is only searched again when the instant
+     * leaves the period of the previous one, so converting instants in order is a couple of comparisons.
+     *
+     * @param instant The instant, in seconds since the Epoch.
+     */
+    void setInstant(time_t instant);
+
+    /**
+     * @brief Moves the clock to another instant with its nanoseconds, keeping its zone.
+     *
+     * @param instant The instant, in seconds and nanoseconds since the Epoch.
+     */
+    void setInstant(timespec instant);
+
     /**
      * @brief Returns the full year (e.g., 2025).
      * @return Current year as an integer.
@@ -98,6 +145,12 @@ public:
      */
     auto getSec() const -> int override;
 
+    /**
+     * @brief Returns the current nanosecond of the second (0–999999999).
+     * @return Nanoseconds elapsed since the beginning of the second.
+     */
+    auto getNanosecond() const -> int override;
+
     /**
      * @brief Returns the current day of the week as an integer (0 = Sunday, 6 = Saturday).
      * @return Integer representing the day of the week.
@@ -106,10 +159,32 @@ public:
 
     /**
      * @brief Returns the current timezone abbreviation as a string.
+     *
      * @return Timezone string (e.g., "UTC", "CEST").
      */
     auto getTimeZone() const -> std::string override;
 
+    /**
+     * @brief Captures all the broken-down fields of the stored instant at once.
+     *
+     * The snapshot's time zone is a view of the abbreviation held by the zone of the clock.
+     *
+     * @return The fields of the stored instant.
+     */
+    auto getSnapshot() const -> Snapshot;
+
+    /**
+     * @brief Reads the current time of the system's real-time clock, with its nanoseconds.
+     *
+     * The coarse clock (`CLOCK_REALTIME_COARSE`) is read from the vDSO without touching the hardware
+     * counter, which makes it cheaper when stamping at very high rates, at the cost of only being updated
+     * at each scheduler tick (a few milliseconds). Where it doesn't exist, the precise clock is read.
+     *
+     * @param isCoarse If true, reads the coarse clock; otherwise, the precise one.
+     * @return The current time, in seconds and nanoseconds since the Epoch.
+     */
+    static auto readTime(bool isCoarse) -> timespec;
+
     /**
      * @brief Sets the system's real-time clock to a new time.
      *
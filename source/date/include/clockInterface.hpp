@@ -13,6 +13,7 @@ public:
     virtual auto getHour() const -> int             = 0;
     virtual auto getMin() const -> int              = 0;
     virtual auto getSec() const -> int              = 0;
+    virtual auto getNanosecond() const -> int       = 0;
     virtual auto getDayOfTheWeek() const -> int     = 0;
     virtual auto getTimeZone() const -> std::string = 0;
 };
@@ -26,9 +26,13 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string_view>
 
+#include "nameIndex.hpp"
+
 /**
  * @brief Represents the days of the week.
  *
@@ -45,6 +49,16 @@ enum class Day : std::uint8_t
     Saturday  = 6
 };
 
+inline constexpr std::array<std::string_view, 7> SHORT_DAY_NAMES = {
+    "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"}; // Abbreviated names, in the order of the Day values
+
+inline constexpr std::array<std::string_view, 7> LONG_DAY_NAMES = {
+    "Sunday", "Monday", "Tuesday",
+    "Wednesday", "Thursday", "Friday", "Saturday"}; // Full names, in the order of the Day values
+
+inline constexpr NameIndex<7, 16> SHORT_DAY_INDEX(SHORT_DAY_NAMES); // Perfect hash of the abbreviated names
+inline constexpr NameIndex<7, 16> LONG_DAY_INDEX(LONG_DAY_NAMES);   // Perfect hash of the full names
+
 /**
  * @brief Returns the abbreviated (short) name of a day of the week.
  *
@@ -55,10 +69,7 @@ enum class Day : std::uint8_t
  */
 inline auto getShortDayName(int day) -> std::string_view
 {
-    static constexpr std::array<std::string_view, 7> shortNames = {
-        "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
-
-    return shortNames.at(day);
+    return SHORT_DAY_NAMES.at(day);
 }
 
 /**
@@ -71,9 +82,58 @@ inline auto getShortDayName(int day) -> std::string_view
  */
 inline auto getLongDayName(int day) -> std::string_view
 {
-    static constexpr std::array<std::string_view, 7> longNames = {
-        "Sunday", "Monday", "Tuesday",
-        "Wednesday", "Thursday", "Friday", "Saturday"};
+    return LONG_DAY_NAMES.at(day);
+}
+
+/**
+ * @brief Returns the abbreviated name of a day of the week, without checking its range.
+ *
+ * Meant for formatting broken-down times, whose day of the week is always in range; use `getShortDayName()` otherwise.
+ *
+ * @param day The day of the week, which must be in the range [0, 6].
+ * @return The 3-letter abbreviation of the day of the week.
+ */
+constexpr auto shortDayName(int day) -> std::string_view
+{
+    return SHORT_DAY_NAMES[static_cast<std::size_t>(day)];
+}
+
+/**
+ * @brief Returns the full name of a day of the week, without checking its range.
+ *
+ * @param day The day of the week, which must be in the range [0, 6].
+ * @return The full name of the day of the week.
+ */
+constexpr auto longDayName(int day) -> std::string_view
+{
+    return LONG_DAY_NAMES[static_cast<std::size_t>(day)];
+}
+
+/**
+ * @brief Finds a day of the week from its abbreviated name, ignoring case.
+ *
+ * @param name The whole abbreviated name (e.g., "thu").
+ * @return The day of the week, or nothing if the name isn't one.
+ */
+constexpr auto findShortDayName(std::string_view name) -> std::optional<Day>
+{
+    const int day = SHORT_DAY_INDEX.find(name); // Position of the name, -1 if there's none
 
-    return longNames.at(day);
+    return day >= 0 ? std::optional<Day>(static_cast<Day>(day)) : std::nullopt;
 }
+
+/**
+ * @brief Finds a day of the week from its full name, ignoring case.
+ *
+ * @param name The whole full name (e.g., "WEDNESDAY").
+ * @return The day of the week, or nothing if the name isn't one.
+ */
+constexpr auto findLongDayName(std::string_view name) -> std::optional<Day>
+{
+    const int day = LONG_DAY_INDEX.find(name); // Position of the name, -1 if there's none
+
+    return day >= 0 ? std::optional<Day>(static_cast<Day>(day)) : std::nullopt;
+}
+
+static_assert(findShortDayName("thu") == Day::Thursday && findLongDayName("WEDNESDAY") == Day::Wednesday, "Names are found without case");
+static_assert(!findShortDayName("Thursday") && !findLongDayName("Thu") && !findShortDayName(""), "Only whole names are found");
@@ -0,0 +1,103 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+/**
+ * @brief Number of two-digit pairs in the digit table ("00" to "99").
+ */
+inline constexpr unsigned DIGIT_PAIR_COUNT = 100;
+
+/**
+ * @brief Builds the table of all the two-digit pairs, "00" to "99", one after the other.
+ *
+ * @return The 200 characters of the table.
+ */
+constexpr auto makeDigitPairs() -> std::array<char, 2 * DIGIT_PAIR_COUNT>
+{
+    std::array<char, 2 * DIGIT_PAIR_COUNT> pairs = {};
+
+    for (unsigned value = 0; value < DIGIT_PAIR_COUNT; value++)
+    {
+        pairs.at(2 * value)     = static_cast<char>('0' + value / 10);
+        pairs.at(2 * value + 1) = static_cast<char>('0' + value % 10);
+    }
+
+    return pairs;
+}
+
+/**
+ * @brief Table of all the two-digit pairs, generated at compile time.
+ */
+inline constexpr std::array<char, 2 * DIGIT_PAIR_COUNT> DIGIT_PAIRS = makeDigitPairs();
+
+/**
+ * @brief Writes a value as exactly two digits, with a leading zero if needed.
+ *
+ * Both digits are copied from the pair table, without any division or branch.
+ *
+ * @param destination Where to write the two digits.
+ * @param value The value to write, in the range [0, 99].
+ * @return A pointer past the last digit written.
+ */
+constexpr auto writeTwoDigits(char* destination, unsigned value) -> char*
+{
+    destination[0] = DIGIT_PAIRS[2 * value];     // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    destination[1] = DIGIT_PAIRS[2 * value + 1]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+    return destination + 2;
+}
+
+/**
+ * @brief Writes a value as exactly `width` digits, with leading zeros if needed.
+ *
+ * The digits are written two at a time, from the last pair to the first.
+ *
+ * @param destination Where to write the digits.
+ * @param value The value to write, lower than 10 to the power of `width`.
+ * @param width The number of digits to write.
+ * @return A pointer past the last digit written.
+ */
+constexpr auto writeDigits(char* destination, unsigned value, size_t width) -> char*
+{
+    char* position = destination + width;
+
+    while (position - destination >= 2)
+    {
+        position -= 2;
+        writeTwoDigits(position, value % DIGIT_PAIR_COUNT);
+        value /= DIGIT_PAIR_COUNT;
+    }
+
+    if (position != destination)
+    {
+        *(--position) = static_cast<char>('0' + value % 10);
+    }
+
+    return destination + width;
+}
@@ -0,0 +1,144 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "layout.hpp"
+
+/**
+ * @brief Operations a compiled format is made of.
+ *
+ * Each directive of the format string maps to one opcode, and the text between directives is
+ * gathered into `Literal` runs.
+ */
+enum class Opcode : std::uint8_t
+{
+    Literal    = 0,  // Text copied as it is
+    ShortDay   = 1,  // %a : Abbreviated weekday name
+    LongDay    = 2,  // %A : Full weekday name
+    ShortMonth = 3,  // %b : Abbreviated month name
+    LongMonth  = 4,  // %B : Full month name
+    Day        = 5,  // %d : Day of the month (01–31)
+    DayNoPad   = 6,  // %e : Day of the month, without padding
+    Hour       = 7,  // %H : Hour (00–23)
+    Month      = 8,  // %m : Month (01–12)
+    Minute     = 9,  // %M : Minute (00–59)
+    HourMinute = 10, // %R : Hour and minute (%H:%M)
+    Second     = 11, // %S : Second (00–59)
+    Time       = 12, // %T : Hour, minute and second (%H:%M:%S)
+    ShortYear  = 13, // %y : Last two digits of the year
+    Year       = 14, // %Y : Full year
+    TimeZone   = 15, // %Z : Timezone abbreviation
+    Fraction   = 16  // %N : Nanoseconds, or their first digits with a width (%3N, %6N, ...)
+};
+
+/**
+ * @brief Number of digits of the fraction of the second written by `%N`, one per nanosecond decimal.
+ */
+inline constexpr size_t FRACTION_DIGITS = 9;
+
+/**
+ * @brief One step of a compiled format.
+ */
+struct Token
+{
+    Opcode opcode;     // What the step writes
+    size_t offset = 0; // For `Literal`, position of the text in FormatProgram::literals
+    size_t length = 0; // For `Literal`, length of the text; for `Fraction`, number of digits
+};
+
+/**
+ * @brief Length of the longest day or month name ("Wednesday", "September").
+ */
+inline constexpr size_t NAME_MAX_LENGTH = 9;
+
+/**
+ * @brief Length of the longest int written in decimal, its sign included ("-2147483648").
+ */
+inline constexpr size_t NUMBER_MAX_LENGTH = std::numeric_limits<int>::digits10 + 2;
+
+/**
+ * @brief Returns the largest number of characters a step of a compiled format can write.
+ *
+ * Names and numbers of valid dates have a bounded width, a year being bounded by the width of an int. A
+ * timezone abbreviation is counted as `LAYOUT_ZONE_LENGTH` characters: a longer one, or a field out of
+ * its range, only makes the output grow once more.
+ *
+ * @param token The step.
+ * @return The largest number of characters the step writes.
+ */
+constexpr auto maxTokenLength(const Token& token) -> size_t
+{
+    switch (token.opcode)
+    {
+    case Opcode::Literal:
+    case Opcode::Fraction:
+        return token.length;
+    case Opcode::ShortDay:
+    case Opcode::ShortMonth:
+        return 3;
+    case Opcode::LongDay:
+    case Opcode::LongMonth:
+        return NAME_MAX_LENGTH;
+    case Opcode::HourMinute:
+        return 5;
+    case Opcode::Time:
+        return 8;
+    case Opcode::Year:
+        return NUMBER_MAX_LENGTH;
+    case Opcode::TimeZone:
+        return LAYOUT_ZONE_LENGTH;
+    default:
+        return 2;
+    }
+}
+
+/**
+ * @brief A format string compiled once into a list of steps, ready to be executed against any number of instants.
+ *
+ * The text of all the literal runs is stored contiguously in `literals`, the tokens referring to it by
+ * offset and length so a program can be copied or moved freely.
+ *
+ * When the format string is one of the common layouts (see `Layout`), the program also records it, so
+ * that the layout's own writer can be used instead of executing the steps one by one.
+ *
+ * The largest length of a rendered date is computed when compiling, so that the output is grown once.
+ *
+ * @see Parser::CompileFormat
+ * @see Parser::ExecuteFormat
+ */
+struct FormatProgram
+{
+    std::string literals;               // Text of all the literal runs, one after the other
+    std::vector<Token> tokens;          // Steps of the program, in order
+    Layout layout    = Layout::Generic; // Common layout the format string is, if any
+    size_t maxLength = 0;               // Largest number of characters a rendered date can have, see `maxTokenLength()`
+};
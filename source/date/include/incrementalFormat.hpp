@@ -0,0 +1,88 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "format.hpp"
+#include "snapshot.hpp"
+
+/**
+ * @class IncrementalFormat
+ * @brief Keeps a compiled format rendered, re-rendering only the fields that changed since the last instant.
+ *
+ * Consecutive instants usually differ by a few fields only (the seconds, sometimes the minutes), so the
+ * rendered text is kept along with the position of each step. Each update compares the new fields with
+ * the previous ones: a changed step of the same width is overwritten in place, and only a change of width
+ * (e.g. `%e` going from 9 to 10) renders the rest of the text again.
+ */
+class IncrementalFormat
+{
+private:
+    FormatProgram program;      // The compiled format
+    std::string rendered;       // The format rendered for the previous fields
+    std::vector<size_t> starts; // Position in rendered of the text of each step, plus the end of the text
+    Snapshot previous;          // Fields the text was rendered for
+    bool isRendered = false;    // Indicates that rendered holds a full rendering
+    std::string scratch;        // Text of a step being rendered again
+
+    /**
+     * @brief Checks whether what a step writes may differ between two sets of fields.
+     *
+     * @param token The step.
+     * @param before The fields the step was rendered for.
+     * @param after The new fields.
+     * @return True if a field the step writes changed, false otherwise.
+     */
+    static auto hasChanged(const Token& token, const Snapshot& before, const Snapshot& after) -> bool;
+
+    /**
+     * @brief Renders the steps from a given one to the end, replacing their previous text.
+     *
+     * @param first The first step to render.
+     * @param fields The fields to render.
+     */
+    void renderFrom(size_t first, const Snapshot& fields);
+
+public:
+    /**
+     * @brief Constructs an incremental rendering of a compiled format.
+     *
+     * @param program The compiled format, see `Parser::CompileFormat()`.
+     */
+    explicit IncrementalFormat(FormatProgram program);
+
+    /**
+     * @brief Renders the format for new fields, reusing what didn't change since the previous call.
+     *
+     * @param fields The fields to render.
+     * @return The rendered text, valid until the next call.
+     */
+    auto update(const Snapshot& fields) -> std::string_view;
+};
@@ -0,0 +1,221 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "timeOperand.hpp"
+
+/**
+ * @brief The fields of an ISO 8601 / RFC 3339 timestamp, once validated.
+ */
+struct IsoTimestamp
+{
+    TimeOperand fields;     // Date and time of the day, and why the timestamp was rejected if it was
+    int nanosecond = 0;     // Fraction of the second, in nanoseconds
+    int offset     = 0;     // Offset from UTC in seconds, east being positive, when hasOffset is set
+    bool hasOffset = false; // Indicates that the timestamp ends with `Z` or an offset; otherwise it's a local time
+};
+
+/**
+ * @brief Loads eight bytes of text into an integer, in memory order.
+ *
+ * @param text The text, holding at least eight bytes from the position.
+ * @param position The position of the first byte.
+ * @return The bytes, as a single integer.
+ */
+constexpr auto loadEightBytes(std::string_view text, size_t position) -> std::uint64_t
+{
+    std::array<char, 8> bytes = {};
+
+    for (size_t i = 0; i < bytes.size(); i++)
+    {
+        bytes.at(i) = text[position + i];
+    }
+
+    return std::bit_cast<std::uint64_t>(bytes);
+}
+
+/**
+ * @brief Checks eight bytes of text against a fixed layout of digits and separators, all at once.
+ *
+ * The bytes are handled as the lanes of a single integer (SWAR). `expected` holds '0' where a digit goes, the
+ * separator where one goes, and 0 for a byte checked elsewhere. Once it is subtracted, a digit lane holds 0–9
+ * and a separator lane 0, which adding `limits` (0x76 or 0x7F) checks through the top bit of each lane: a
+ * byte below what is expected borrows and sets the top bit itself. No lane can carry into the next one
+ * without having set its own top bit first.
+ *
+ * @param word The bytes of the text, see `loadEightBytes()`.
+ * @param expected The bytes of the layout.
+ * @param limits The amount that sets the top bit of a lane once it is over its maximum.
+ * @param values Receives the value of each byte, 0–9 for the digits.
+ * @return True if every digit and separator is where it should be, false otherwise.
+ */
+constexpr auto checkEightBytes(std::uint64_t word, std::uint64_t expected, std::uint64_t limits, std::array<std::uint8_t, 8>& values) -> bool
+{
+    constexpr std::uint64_t TOP_BITS = 0x8080808080808080; // The top bit of each lane
+
+    const std::uint64_t lanes = word - expected;
+
+    values = std::bit_cast<std::array<std::uint8_t, 8>>(lanes);
+
+    return (((lanes + limits) | lanes) & TOP_BITS) == 0;
+}
+
+/**
+ * @brief Parses an ISO 8601 / RFC 3339 timestamp of the fixed-width `YYYY-MM-DDThh:mm:ss` layout.
+ *
+ * The date and time may be separated by `T`, `t` or a space, and followed by a fraction of the second
+ * (after `.` or `,`, of any length, digits past the nanoseconds being ignored), then by `Z`, `z` or an
+ * offset (`+hh:mm`, `+hhmm` or `+hh`). Without either, the timestamp is a local time.
+ *
+ * The sixteen bytes of `YYYY-MM-DDThh:mm` are checked as two 64-bit words rather than one byte at a time,
+ * which leaves a handful of branches for the whole timestamp. Nothing is allocated and nothing is thrown.
+ *
+ * @param text The timestamp (e.g., "2025-07-04T12:30:45Z", "2025-07-04 12:30:45.123+02:00").
+ * @return The fields of the timestamp, or the reason it was rejected.
+ */
+constexpr auto parseIso8601(std::string_view text) -> IsoTimestamp
+{
+    constexpr std::uint64_t DATE_EXPECTED = std::bit_cast<std::uint64_t>(std::array<char, 8>{'0', '0', '0', '0', '-', '0', '0', '-'});
+    constexpr std::uint64_t DATE_LIMITS   = std::bit_cast<std::uint64_t>(std::array<std::uint8_t, 8>{0x76, 0x76, 0x76, 0x76, 0x7F, 0x76, 0x76, 0x7F});
+    constexpr std::uint64_t TIME_EXPECTED = std::bit_cast<std::uint64_t>(std::array<char, 8>{'0', '0', 0, '0', '0', ':', '0', '0'});
+    constexpr std::uint64_t TIME_LIMITS   = std::bit_cast<std::uint64_t>(std::array<std::uint8_t, 8>{0x76, 0x76, 0x00, 0x76, 0x76, 0x7F, 0x76, 0x76});
+    constexpr size_t LAYOUT_LENGTH        = 19; // Length of YYYY-MM-DDThh:mm:ss
+
+    IsoTimestamp result;                              // Fields being parsed
+    TimeOperand& fields              = result.fields; // Date and time of the day
+    std::array<std::uint8_t, 8> date = {};            // Digits of YYYY-MM-
+    std::array<std::uint8_t, 8> time = {};            // Digits of DDThh:mm
+    size_t i                         = 0;             // Position in the text, past the fixed-width part
+
+    if (text.size() < LAYOUT_LENGTH)
+    {
+        fields.error = OperandError::Length;
+        return result;
+    }
+
+    const bool isValid = checkEightBytes(loadEightBytes(text, 0), DATE_EXPECTED, DATE_LIMITS, date)
+                         & checkEightBytes(loadEightBytes(text, 8), TIME_EXPECTED, TIME_LIMITS, time)
+                         & (text[10] == 'T' || text[10] == 't' || text[10] == ' ')
+                         & (text[16] == ':')
+                         & (static_cast<unsigned>(text[17] - '0') <= 9)
+                         & (static_cast<unsigned>(text[18] - '0') <= 9);
+
+    if (!isValid)
+    {
+        fields.error = OperandError::Digit;
+        return result;
+    }
+
+    fields.year   = date[0] * 1000 + date[1] * 100 + date[2] * 10 + date[3];
+    fields.month  = static_cast<unsigned>(date[5] * 10 + date[6]);
+    fields.day    = time[0] * 10 + time[1];
+    fields.hour   = time[3] * 10 + time[4];
+    fields.minute = time[6] * 10 + time[7];
+    fields.second = (text[17] - '0') * 10 + (text[18] - '0');
+    i             = LAYOUT_LENGTH;
+
+    // The fraction, truncated to the nanoseconds
+    if (i < text.size() && (text[i] == '.' || text[i] == ','))
+    {
+        int scale = 100000000; // Value of the next digit, in nanoseconds
+
+        for (i++; i < text.size() && static_cast<unsigned>(text[i] - '0') <= 9; i++)
+        {
+            result.nanosecond += (text[i] - '0') * scale;
+            scale /= 10;
+        }
+
+        if (text[i - 1] == '.' || text[i - 1] == ',')
+        {
+            fields.error = OperandError::Digit;
+            return result;
+        }
+    }
+
+    // The zone designator
+    if (i < text.size() && (text[i] == 'Z' || text[i] == 'z'))
+    {
+        result.hasOffset = true;
+        i++;
+    }
+    else if (i < text.size() && (text[i] == '+' || text[i] == '-'))
+    {
+        const int sign              = text[i] == '-' ? -1 : 1;            // Sign of the offset, east being positive
+        const std::string_view zone = text.substr(i + 1);                 // Digits of the offset
+        const bool hasColon         = zone.size() == 5 && zone[2] == ':'; // Indicates the +hh:mm form
+        const bool isDigit          = [zone, hasColon]
+        {
+            for (size_t digit = 0; digit < zone.size(); digit++)
+            {
+                if ((digit != 2 || !hasColon) && static_cast<unsigned>(zone[digit] - '0') > 9)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }();
+
+        if (!isDigit || (zone.size() != 2 && zone.size() != 4 && !hasColon))
+        {
+            fields.error = OperandError::Zone;
+            return result;
+        }
+
+        const int hours   = (zone[0] - '0') * 10 + (zone[1] - '0');
+        const int minutes = zone.size() == 2 ? 0 : (zone[zone.size() - 2] - '0') * 10 + (zone[zone.size() - 1] - '0');
+
+        if (hours > 23 || minutes > 59)
+        {
+            fields.error = OperandError::Zone;
+            return result;
+        }
+
+        result.hasOffset = true;
+        result.offset    = sign * (hours * 3600 + minutes * 60);
+        i                = text.size();
+    }
+
+    if (i != text.size())
+    {
+        fields.error = OperandError::Length;
+        return result;
+    }
+
+    fields.error = checkOperandFields(fields);
+
+    return result;
+}
+
+static_assert(parseIso8601("2025-07-04T12:30:45Z").fields.second == 45 && parseIso8601("2025-07-04T12:30:45Z").hasOffset, "UTC timestamps");
+static_assert(parseIso8601("2025-07-04 12:30:45.5-02:30").offset == -9000 && parseIso8601("2025-07-04t12:30:45,5").nanosecond == 500000000, "Fractions and offsets");
+static_assert(parseIso8601("2025-07-04T12:30/45").fields.error == OperandError::Digit && parseIso8601("2025-02-29T12:30:45").fields.error == OperandError::Day, "Invalid timestamps");
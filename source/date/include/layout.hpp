@@ -0,0 +1,225 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "day.hpp"
+#include "digits.hpp"
+#include "month.hpp"
+
+/**
+ * @brief Formats common enough to be written by a dedicated writer rather than by the interpreter.
+ */
+enum class Layout : std::uint8_t
+{
+    Generic = 0, // Any format, executed step by step
+    Default = 1, // "%a %b %e %H:%M:%S %Z %Y", the format of date without any operand
+    Iso8601 = 2, // "%Y-%m-%dT%T", ISO 8601
+    Rfc5322 = 3  // "%a, %d %b %Y %T %Z", the date of RFC 5322 mail headers, with the zone abbreviation
+};
+
+/**
+ * @brief Format strings of the layouts, without the leading `+`, in the order of Layout.
+ */
+inline constexpr std::array<std::string_view, 4> LAYOUT_FORMATS = {"", "%a %b %e %H:%M:%S %Z %Y", "%Y-%m-%dT%T", "%a, %d %b %Y %T %Z"};
+
+/**
+ * @brief Longest time zone abbreviation a layout writes itself, longer ones being left to the interpreter.
+ */
+inline constexpr size_t LAYOUT_ZONE_LENGTH = 16;
+
+/**
+ * @brief Size of the buffer the layouts are written to, enough for the longest of them.
+ */
+inline constexpr size_t LAYOUT_BUFFER_SIZE = 32 + LAYOUT_ZONE_LENGTH;
+
+/**
+ * @brief Returns the layout a format string is, if any.
+ *
+ * @param format The format string, with or without its leading `+`.
+ * @return The layout, or `Layout::Generic` if the format is none of them.
+ */
+constexpr auto findLayout(std::string_view format) -> Layout
+{
+    if (format.starts_with('+'))
+    {
+        format.remove_prefix(1);
+    }
+
+    for (size_t i = 1; i < LAYOUT_FORMATS.size(); i++)
+    {
+        if (format == LAYOUT_FORMATS.at(i))
+        {
+            return static_cast<Layout>(i);
+        }
+    }
+
+    return Layout::Generic;
+}
+
+/**
+ * @brief Copies the three letters of a day or month abbreviation.
+ *
+ * @param destination Where to write the letters.
+ * @param name The abbreviation, three letters long.
+ * @return A pointer past the last letter written.
+ */
+constexpr auto writeAbbreviation(char* destination, std::string_view name) -> char*
+{
+    destination[0] = name[0];
+    destination[1] = name[1];
+    destination[2] = name[2];
+
+    return destination + 3;
+}
+
+/**
+ * @brief Writes the time of the day as `hh:mm:ss`.
+ *
+ * @param destination Where to write the time.
+ * @param hour The hour, minute and second, each in the range [0, 99].
+ * @return A pointer past the last character written.
+ */
+constexpr auto writeClockTime(char* destination, unsigned hour, unsigned minute, unsigned second) -> char*
+{
+    destination    = writeTwoDigits(destination, hour);
+    *destination++ = ':';
+    destination    = writeTwoDigits(destination, minute);
+    *destination++ = ':';
+
+    return writeTwoDigits(destination, second);
+}
+
+/**
+ * @brief Writes a date with the fixed-layout writer of a layout, appending it to a string.
+ *
+ * Every field is written at a position known in advance into a buffer on the stack, then the buffer is
+ * appended at once. The output is the same as the interpreter's, byte for byte: dates the layouts can't
+ * write as it would (a year that isn't four digits long, an out of range field, a very long zone
+ * abbreviation) are left to it.
+ *
+ * @tparam Fields The type of the source of the date and time fields, see `Parser::RenderFormat()`.
+ * @param layout The layout of the format, not `Layout::Generic`.
+ * @param fields The source of the date and time fields.
+ * @param output The string the formatted date is appended to.
+ * @return True if the date was written, false if it has to be written by the interpreter.
+ */
+template <typename Fields>
+auto writeLayout(Layout layout, const Fields& fields, std::string& output) -> bool
+{
+    const auto year         = static_cast<unsigned>(fields.getYear());
+    const auto month        = static_cast<unsigned>(fields.getMonth());
+    const auto day          = static_cast<unsigned>(fields.getDay());
+    const auto hour         = static_cast<unsigned>(fields.getHour());
+    const auto minute       = static_cast<unsigned>(fields.getMin());
+    const auto second       = static_cast<unsigned>(fields.getSec());
+    const auto dayOfTheWeek = static_cast<unsigned>(fields.getDayOfTheWeek());
+
+    std::array<char, LAYOUT_BUFFER_SIZE> buffer = {};            // The formatted date
+    char* position                              = buffer.data(); // End of the formatted date
+
+    // Negative values wrap around, so a single comparison checks both bounds
+    if (year - 1000 > 8999 || month > 11 || day - 1 > 30 || hour > 23 || minute > 59 || second > 60 || dayOfTheWeek > 6)
+    {
+        return false;
+    }
+
+    switch (layout)
+    {
+    case Layout::Generic:
+        return false;
+    case Layout::Default:
+    {
+        const auto& zone = fields.getTimeZone(); // Abbreviation, copied between the time and the year
+
+        if (zone.size() > LAYOUT_ZONE_LENGTH)
+        {
+            return false;
+        }
+
+        position    = writeAbbreviation(position, shortDayName(static_cast<int>(dayOfTheWeek)));
+        *position++ = ' ';
+        position    = writeAbbreviation(position, shortMonthName(static_cast<int>(month)));
+        *position++ = ' ';
+
+        // %e isn't padded
+        if (day >= 10)
+        {
+            *position++ = static_cast<char>('0' + day / 10);
+        }
+
+        *position++ = static_cast<char>('0' + day % 10);
+        *position++ = ' ';
+        position    = writeClockTime(position, hour, minute, second);
+        *position++ = ' ';
+        position    = zone.copy(position, zone.size()) + position;
+        *position++ = ' ';
+        position    = writeDigits(position, year, 4);
+        break;
+    }
+    case Layout::Iso8601:
+        position    = writeDigits(position, year, 4);
+        *position++ = '-';
+        position    = writeTwoDigits(position, static_cast<unsigned>(monthNumber(static_cast<int>(month))));
+        *position++ = '-';
+        position    = writeTwoDigits(position, day);
+        *position++ = 'T';
+        position    = writeClockTime(position, hour, minute, second);
+        break;
+    case Layout::Rfc5322:
+    {
+        const auto& zone = fields.getTimeZone(); // Abbreviation, at the end of the date
+
+        if (zone.size() > LAYOUT_ZONE_LENGTH)
+        {
+            return false;
+        }
+
+        position    = writeAbbreviation(position, shortDayName(static_cast<int>(dayOfTheWeek)));
+        *position++ = ',';
+        *position++ = ' ';
+        position    = writeTwoDigits(position, day);
+        *position++ = ' ';
+        position    = writeAbbreviation(position, shortMonthName(static_cast<int>(month)));
+        *position++ = ' ';
+        position    = writeDigits(position, year, 4);
+        *position++ = ' ';
+        position    = writeClockTime(position, hour, minute, second);
+        *position++ = ' ';
+        position    = zone.copy(position, zone.size()) + position;
+        break;
+    }
+    }
+
+    output.append(buffer.data(), static_cast<size_t>(position - buffer.data()));
+
+    return true;
+}
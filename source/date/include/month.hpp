@@ -26,9 +26,13 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string_view>
 
+#include "nameIndex.hpp"
+
 /**
  * @brief Represents the month of the year.
  *
@@ -50,6 +54,17 @@ enum class Month : std::uint8_t
     December  = 11
 };
 
+inline constexpr std::array<std::string_view, 12> SHORT_MONTH_NAMES = {
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+    "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"}; // Abbreviated names, in the order of the Month values
+
+inline constexpr std::array<std::string_view, 12> LONG_MONTH_NAMES = {
+    "January", "February", "March", "April", "May", "June",
+    "July", "August", "September", "October", "November", "December"}; // Full names, in the order of the Month values
+
+inline constexpr NameIndex<12, 32> SHORT_MONTH_INDEX(SHORT_MONTH_NAMES); // Perfect hash of the abbreviated names
+inline constexpr NameIndex<12, 32> LONG_MONTH_INDEX(LONG_MONTH_NAMES);   // Perfect hash of the full names
+
 /**
  * @brief Returns the abbreviated (short) name of a month.
  *
@@ -60,11 +75,7 @@ enum class Month : std::uint8_t
  */
 inline auto getShortMonthName(int month) -> std::string_view
 {
-    static constexpr std::array<std::string_view, 12> shortNames = {
-        "Jan", "Feb", "Mar", "Apr", "May", "Jun",
-        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
-
-    return shortNames.at(month);
+    return SHORT_MONTH_NAMES.at(month);
 }
 
 /**
@@ -77,9 +88,69 @@ inline auto getShortMonthName(int month) -> std::string_view
  */
 inline auto getLongMonthName(int month) -> std::string_view
 {
-    static constexpr std::array<std::string_view, 12> longNames = {
-        "January", "February", "March", "April", "May", "June",
-        "July", "August", "September", "October", "November", "December"};
+    return LONG_MONTH_NAMES.at(month);
+}
+
+/**
+ * @brief Returns the number of a month in numeric dates, as `%m` writes and reads it.
+ *
+ * @param month The month (0 = January, 11 = December).
+ * @return The number of the month (1 = January, 12 = December).
+ */
+constexpr auto monthNumber(int month) -> int
+{
+    return month + 1;
+}
+
+/**
+ * @brief Returns the abbreviated name of a month, without checking its range.
+ *
+ * Meant for formatting broken-down times, whose month is always in range; use `getShortMonthName()` otherwise.
+ *
+ * @param month The month, which must be in the range [0, 11].
+ * @return The 3-letter abbreviation of the month.
+ */
+constexpr auto shortMonthName(int month) -> std::string_view
+{
+    return SHORT_MONTH_NAMES[static_cast<std::size_t>(month)];
+}
+
+/**
+ * @brief Returns the full name of a month, without checking its range.
+ *
+ * @param month The month, which must be in the range [0, 11].
+ * @return The full name of the month.
+ */
+constexpr auto longMonthName(int month) -> std::string_view
+{
+    return LONG_MONTH_NAMES[static_cast<std::size_t>(month)];
+}
 
-    return longNames.at(month);
+/**
+ * @brief Finds a month from its abbreviated name, ignoring case.
+ *
+ * @param name The whole abbreviated name (e.g., "sep").
+ * @return The month, or nothing if the name isn't one.
+ */
+constexpr auto findShortMonthName(std::string_view name) -> std::optional<Month>
+{
+    const int month = SHORT_MONTH_INDEX.find(name); // Position of the name, -1 if there's none
+
+    return month >= 0 ? std::optional<Month>(static_cast<Month>(month)) : std::nullopt;
 }
+
+/**
+ * @brief Finds a month from its full name, ignoring case.
+ *
+ * @param name The whole full name (e.g., "SEPTEMBER").
+ * @return The month, or nothing if the name isn't one.
+ */
+constexpr auto findLongMonthName(std::string_view name) -> std::optional<Month>
+{
+    const int month = LONG_MONTH_INDEX.find(name); // Position of the name, -1 if there's none
+
+    return month >= 0 ? std::optional<Month>(static_cast<Month>(month)) : std::nullopt;
+}
+
+static_assert(findShortMonthName("sep") == Month::September && findLongMonthName("MAY") == Month::May, "Names are found without case");
+static_assert(!findShortMonthName("Sept") && !findLongMonthName("Janu") && !findLongMonthName("Mayo"), "Only whole names are found");
@@ -0,0 +1,75 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <ctime>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "format.hpp"
+#include "timeZone.hpp"
+
+/**
+ * @class MultiZone
+ * @brief Renders a single instant in several time zones at once.
+ *
+ * Each zone is loaded once, when it is added. The instant is broken down once in UTC, then each zone only
+ * looks up its offset and abbreviation and moves the UTC fields by that offset (see `shiftBreakDown()`),
+ * so rendering in n zones costs one breakdown and n lookups, all in one process.
+ */
+class MultiZone
+{
+private:
+    std::vector<TimeZone> zones;     // The zones, in the order they were added
+    std::vector<ZonePeriod> periods; // Period of each zone holding the last instant, reused while the instants stay in it
+
+public:
+    /**
+     * @brief Adds a zone, designated as by the TZ environment variable.
+     *
+     * @param name The zone, see `TimeZone::loadName()`.
+     * @return True if the zone was loaded, false otherwise, in which case nothing is added.
+     */
+    auto add(std::string_view name) -> bool;
+
+    /**
+     * @brief Returns the number of zones added.
+     *
+     * @return The number of zones.
+     */
+    auto size() const -> size_t;
+
+    /**
+     * @brief Renders an instant in every zone, one line per zone, in the order they were added.
+     *
+     * @param instant The instant, in seconds and nanoseconds since the Epoch.
+     * @param program The compiled format, see `Parser::CompileFormat()`.
+     * @param output The string the lines are appended to, each followed by a newline.
+     */
+    void render(timespec instant, const FormatProgram& program, std::string& output);
+};
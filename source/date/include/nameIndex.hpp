@@ -0,0 +1,126 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @class NameIndex
+ * @brief A perfect hash table from a fixed set of names back to their position, ignoring case.
+ *
+ * The table is built at compile time: a seed is searched for which every name hashes to its own slot, so
+ * a lookup hashes the text once and compares it to a single name, instead of comparing it to every name
+ * in turn. The hash only reads the length and three letters of the text, so it costs the same for any
+ * length. Names are ASCII letters, compared without case (e.g., "mon", "Mon" and "MON" are all found).
+ *
+ * @tparam Count Number of names.
+ * @tparam Size Number of slots, a power of two larger than the number of names.
+ */
+template <std::size_t Count, std::size_t Size>
+class NameIndex
+{
+    static_assert(Size >= Count && (Size & (Size - 1)) == 0, "The number of slots must be a power of two, larger than the number of names");
+
+private:
+    std::array<std::string_view, Count> names; // Names, in the order of their values
+    std::array<std::uint8_t, Size> slots = {}; // Position of the name in each slot plus one, 0 for an empty slot
+    std::uint32_t seed                   = 0;  // Seed for which no two names share a slot
+
+    // Hashes a name without its case, from its length, its first two letters and its last one
+    static constexpr auto hash(std::string_view name, std::uint32_t seed) -> std::size_t
+    {
+        if (name.empty())
+        {
+            return 0;
+        }
+
+        const std::uint32_t key = static_cast<std::uint8_t>(name[0] | 0x20) | static_cast<std::uint8_t>(name[1 % name.size()] | 0x20) << 8U
+                                  | static_cast<std::uint8_t>(name.back() | 0x20) << 16U | static_cast<std::uint32_t>(name.size()) << 24U;
+
+        // Multiplicative hashing: the high bits of the product depend on every bit of the key
+        return ((key ^ seed) * 2654435769U) >> (32 - std::countr_zero(Size));
+    }
+
+    // Compares a text to a name without case, the name being made of letters only
+    static constexpr auto isSameName(std::string_view text, std::string_view name) -> bool
+    {
+        bool isSame = text.size() == name.size(); // Cleared on the first different letter
+
+        for (std::size_t i = 0; isSame && i < name.size(); i++)
+        {
+            isSame = (text[i] | 0x20) == (name[i] | 0x20);
+        }
+
+        return isSame;
+    }
+
+public:
+    /**
+     * @brief Builds the table, searching for a seed that gives every name its own slot.
+     *
+     * @param list The names, in the order of their values. They must be made of ASCII letters and distinct
+     * without case.
+     */
+    explicit constexpr NameIndex(const std::array<std::string_view, Count>& list) : names(list)
+    {
+        for (;; seed++)
+        {
+            bool isPerfect = true; // Cleared when two names share a slot with this seed
+
+            slots = {};
+
+            for (std::size_t i = 0; i < Count && isPerfect; i++)
+            {
+                const std::size_t slot = hash(names[i], seed); // Slot of the name with this seed
+
+                isPerfect   = slots[slot] == 0;
+                slots[slot] = static_cast<std::uint8_t>(i + 1);
+            }
+
+            if (isPerfect)
+            {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Looks up a name, ignoring case.
+     *
+     * @param text The text to look up, which must be the whole name (e.g., "Mon", "monday").
+     * @return The position of the name, or -1 if the text isn't one of the names.
+     */
+    constexpr auto find(std::string_view text) const -> int
+    {
+        const std::uint8_t slot = slots[hash(text, seed)]; // Position of the only name the text can be, plus one
+
+        return slot != 0 && isSameName(text, names[slot - 1U]) ? slot - 1 : -1;
+    }
+};
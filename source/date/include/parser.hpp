@@ -25,11 +25,32 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
 #include <ctime>
-#include <memory>
 #include <string>
+#include <string_view>
 
 #include "clockInterface.hpp"
+#include "day.hpp"
+#include "digits.hpp"
+#include "format.hpp"
+#include "layout.hpp"
+#include "iso8601.hpp"
+#include "month.hpp"
+#include "timeOperand.hpp"
+#include "timeZone.hpp"
+
+/**
+ * @brief The instant a date operand designates, or the reason it was rejected.
+ */
+struct DateResult
+{
+    timespec time      = {};                 // The instant, valid when there is no error
+    OperandError error = OperandError::None; // Why the operand was rejected, if it was
+};
 
 /**
  * @class Parser
@@ -42,14 +63,28 @@ class Parser
 {
 private:
     /**
-     * @brief Formats an integer as a two-digit string with leading zeros if necessary.
+     * @brief Appends an integer to a string as at least two digits, with a leading zero if necessary.
      *
+     * Values in the range [0, 99] are copied straight from the digit pair table, without any allocation.
+     *
+     * @param output The string the digits are appended to.
      * @param value The integer value to format.
-     * @return A string representing the integer, padded with leading zeros to ensure at least two digits.
      *
-     * For example, an input of 5 will return "05", and an input of 23 will return "23".
+     * For example, an input of 5 will append "05", and an input of 23 will append "23".
      */
-    static auto formatTwoDigits(int value) -> std::string;
+    static void formatTwoDigits(std::string& output, int value);
+
+    /**
+     * @brief Appends the last digits of an integer to a string, without padding.
+     *
+     * The digits are written by `std::to_chars` into a buffer on the stack, so nothing is allocated but the
+     * room the string may need.
+     *
+     * @param output The string the digits are appended to.
+     * @param value The integer value to format.
+     * @param maxLength The largest number of characters appended, the last ones being kept.
+     */
+    static void formatNumber(std::string& output, int value, size_t maxLength);
 
 public:
     /**
@@ -59,6 +94,64 @@ public:
      */
     Parser();
 
+    /**
+     * @brief Compiles a format string into a program that can be executed many times.
+     *
+     * The format string is interpreted once: the directives become opcodes and the text in between is
+     * gathered into literal runs, `+` characters excepted.
+     *
+     * @param argument The format string to compile.
+     * @return The compiled program.
+     *
+     * @see Parser::ExecuteFormat
+     */
+    static auto CompileFormat(std::string_view) -> FormatProgram;
+
+    /**
+     * @brief Executes a compiled format against any source of date fields, appending the formatted date to a string.
+     *
+     * The source only needs the accessors of ClockInterface (`getYear()`, `getMonth()`, ...). When its type
+     * is known at compile time, e.g. a Snapshot, the accessors are inlined and no virtual call is made.
+     * Programs of a common layout are written by the layout's fixed writer, see `writeLayout()`.
+     *
+     * @tparam Fields The type of the source of the date and time fields.
+     * @param program The compiled format.
+     * @param fields The source of the date and time fields.
+     * @param output The string the formatted date is appended to.
+     *
+     * @see Snapshot
+     */
+    template <typename Fields>
+    static void RenderFormat(const FormatProgram&, const Fields&, std::string&);
+
+    /**
+     * @brief Executes a single step of a compiled format, appending what it writes to a string.
+     *
+     * This lets a caller render part of a program again, e.g. only the fields that changed.
+     *
+     * @tparam Fields The type of the source of the date and time fields.
+     * @param program The compiled format the step belongs to.
+     * @param token The step to execute.
+     * @param fields The source of the date and time fields.
+     * @param output The string the result is appended to.
+     */
+    template <typename Fields>
+    static void RenderToken(const FormatProgram&, const Token&, const Fields&, std::string&);
+
+    /**
+     * @brief Executes a compiled format against a clock, appending the formatted date to a string.
+     *
+     * The output string isn't cleared, so the same string can collect many formatted dates.
+     *
+     * Every field is read through the virtual accessors of ClockInterface, so any clock can be used,
+     * including mock ones.
+     *
+     * @param program The compiled format.
+     * @param clock The source of the date and time fields.
+     * @param output The string the formatted date is appended to.
+     */
+    static void ExecuteFormat(const FormatProgram&, const ClockInterface&, std::string&);
+
     /**
      * @brief Parses a format string and returns the formatted date string.
      *
@@ -69,35 +162,199 @@ public:
      * - `%H` : Hour (00–23)
      * - `%M` : Minute (00–59)
      * - `%S` : Second (00–59)
+     * - `%N` : Nanoseconds (000000000–999999999), `%3N` for milliseconds, `%6N` for microseconds
      * - `%Z` : Timezone abbreviation
      * - `%Y` : Full year (e.g., 2025)
      *
      * Characters not preceded by `%` are passed through unchanged, except `+` which is ignored.
      *
+     * This executes the format once, followed by a newline. The format is walked twice rather than compiled:
+     * once to add up the largest length of each directive, then to write them, so that the formatted date
+     * is the only allocation.
+     *
      * @param argument The input format string to parse and transform.
      * @return A formatted date string based on the provided format.
      */
     static auto ParseFormat(const std::string&, const ClockInterface&) -> std::string;
 
     /**
-     * @brief Parses a date string into a timespec structure.
+     * @brief Parses a date operand into the instant it designates.
      *
-     * This function extracts components of a date from a formatted string and converts them into a
-     * POSIX `timespec` structure. The input string is expected to be in the following formats:
+     * The operand has one of the following formats, as described by POSIX:
      *
      * - "MMDDhhmm"                   (basic date: month, day, hour, minute)
-     * - "MMDDhhmmYYYY"               (extended with year)
-     * - "MMDDhhmmYYYY.SS"            (extended with seconds)
+     * - "MMDDhhmmYY"                 (with a two-digit year, in 1969–2068)
+     * - "MMDDhhmmCCYY"               (with a full year)
+     * - any of the above followed by ".SS" (with seconds)
      *
-     * The returned timespec is heap-allocated and returned as a std::unique_ptr for memory safety.
+     * The operand is validated and converted by `parseTimeOperand()`, then the local time is converted to an
+     * instant in the given zone. Nothing is allocated and nothing is thrown.
      *
      * @param argument The input string representing the date.
-     * @return std::unique_ptr<timespec> A pointer to a `timespec` structure representing the parsed date and time.
+     * @param currentYear The year used when the operand has none.
+     * @param zone The zone the operand is a local time of.
+     * @return The instant, whose `tv_nsec` is always 0, or the reason the operand was rejected.
+     */
+    static auto ParseDate(std::string_view, int, const TimeZone&) -> DateResult;
+
+    /**
+     * @brief Reads a formatted date back into the instant it designates, the reverse of `RenderFormat()`.
+     *
+     * The text must match the compiled format exactly: literal text as it is, and each directive as it
+     * would be written, with the following differences:
+     *
+     * - `%e` reads one or two digits, after an optional space
+     * - `%Y` reads up to four digits, after an optional `-`
+     * - `%y` reads a year in 1969–2068, as POSIX requires
+     * - `%a` and `%A` are checked against the names of day.hpp but don't take part in the instant
+     * - `%Z` reads an abbreviation: `UTC`, `UT`, `GMT` or `Z` make the date a UTC time, anything else a
+     *   local time of the given zone
+     *
+     * Fields missing from the format take their value at the Epoch (January 1st 1970, midnight).
+     * Nothing is thrown: a rejected text is reported through `DateResult::error`.
+     *
+     * @param program The compiled format, see `Parser::CompileFormat()`.
+     * @param text The formatted date.
+     * @param zone The zone the date is a local time of, unless `%Z` says otherwise.
+     * @return The instant, or the reason the text was rejected.
+     */
+    static auto ScanFormat(const FormatProgram&, std::string_view, const TimeZone&) -> DateResult;
+
+    /**
+     * @brief Reads an ISO 8601 / RFC 3339 timestamp into the instant it designates.
+     *
+     * This is the fast path of `ScanFormat()` for the fixed-width layouts, see `parseIso8601()`. A timestamp
+     * without `Z` or an offset is a local time of the given zone.
+     *
+     * @param text The timestamp (e.g., "2025-07-04T12:30:45.250Z").
+     * @param zone The zone the timestamp is a local time of, when it has no offset.
+     * @return The instant, or the reason the text was rejected.
+     */
+    static auto ScanIso8601(std::string_view, const TimeZone&) -> DateResult;
+
+    /**
+     * @brief Checks whether a compiled format is an ISO 8601 layout `ScanIso8601()` can read.
      *
-     * @note The year must be in 4-digit format (e.g., 2025), and will be internally converted to a `tm_year` value
-     *       (i.e., years since 1900). The `tv_nsec` field is always set to 0.
+     * These are `%Y-%m-%dT%T` and `%Y-%m-%d %T`, optionally followed by `.%N` (with any width). The fast
+     * path reads a superset of them, including the fractions and offsets of RFC 3339.
      *
-     * @throws std::out_of_range or std::invalid_argument if the string cannot be converted to integers.
+     * @param program The compiled format, see `Parser::CompileFormat()`.
+     * @return True if the format is one of those layouts, false otherwise.
      */
-    static auto ParseDate(std::string&) -> std::unique_ptr<timespec>;
+    static auto IsIso8601(const FormatProgram&) -> bool;
 };
+
+inline void Parser::formatTwoDigits(std::string& output, int value)
+{
+    // Out of range values keep all their digits, as they can't come from a valid date
+    if (value < 0 || value >= static_cast<int>(DIGIT_PAIR_COUNT))
+    {
+        formatNumber(output, value, NUMBER_MAX_LENGTH);
+        return;
+    }
+
+    output.append(&DIGIT_PAIRS.at(2 * static_cast<size_t>(value)), 2);
+}
+
+inline void Parser::formatNumber(std::string& output, int value, size_t maxLength)
+{
+    std::array<char, NUMBER_MAX_LENGTH> digits = {}; // Room for the digits and sign of any int
+    const char* end                            = std::to_chars(digits.data(), digits.data() + digits.size(), value).ptr;
+
+    output.append(end - std::min(maxLength, static_cast<size_t>(end - digits.data())), end);
+}
+
+template <typename Fields>
+void Parser::RenderFormat(const FormatProgram& program, const Fields& fields, std::string& output)
+{
+    // The output grows at most once, to the largest length of the date
+    if (output.capacity() - output.size() < program.maxLength)
+    {
+        output.reserve(output.size() + program.maxLength);
+    }
+
+    if (program.layout != Layout::Generic && writeLayout(program.layout, fields, output))
+    {
+        return;
+    }
+
+    for (const Token& token : program.tokens)
+    {
+        RenderToken(program, token, fields, output);
+    }
+}
+
+template <typename Fields>
+void Parser::RenderToken(const FormatProgram& program, const Token& token, const Fields& fields, std::string& output)
+{
+    switch (token.opcode)
+    {
+    case Opcode::Literal:
+        output.append(program.literals, token.offset, token.length);
+        break;
+    case Opcode::ShortDay:
+        output += shortDayName(fields.getDayOfTheWeek());
+        break;
+    case Opcode::LongDay:
+        output += longDayName(fields.getDayOfTheWeek());
+        break;
+    case Opcode::ShortMonth:
+        output += shortMonthName(fields.getMonth());
+        break;
+    case Opcode::LongMonth:
+        output += longMonthName(fields.getMonth());
+        break;
+    case Opcode::Day:
+        formatTwoDigits(output, fields.getDay());
+        break;
+    case Opcode::DayNoPad:
+        formatNumber(output, fields.getDay(), NUMBER_MAX_LENGTH);
+        break;
+    case Opcode::Hour:
+        formatTwoDigits(output, fields.getHour());
+        break;
+    case Opcode::Month:
+        formatTwoDigits(output, monthNumber(fields.getMonth()));
+        break;
+    case Opcode::Minute:
+        formatTwoDigits(output, fields.getMin());
+        break;
+    case Opcode::HourMinute:
+        formatTwoDigits(output, fields.getHour());
+        output += ":";
+        formatTwoDigits(output, fields.getMin());
+        break;
+    case Opcode::Second:
+        formatTwoDigits(output, fields.getSec());
+        break;
+    case Opcode::Time:
+        formatTwoDigits(output, fields.getHour());
+        output += ":";
+        formatTwoDigits(output, fields.getMin());
+        output += ":";
+        formatTwoDigits(output, fields.getSec());
+        break;
+    case Opcode::ShortYear:
+    {
+        const int year = fields.getYear() % 100; // Last two digits, negative before year 0
+
+        formatTwoDigits(output, year < 0 ? -year : year);
+        break;
+    }
+    case Opcode::Year:
+        formatNumber(output, fields.getYear(), NUMBER_MAX_LENGTH);
+        break;
+    case Opcode::TimeZone:
+        output += fields.getTimeZone();
+        break;
+    case Opcode::Fraction:
+    {
+        // The digits are truncated, not rounded, so that the fraction never reaches the next second
+        std::array<char, FRACTION_DIGITS> digits = {};
+
+        writeDigits(digits.data(), static_cast<unsigned>(fields.getNanosecond()), FRACTION_DIGITS);
+        output.append(digits.data(), token.length);
+        break;
+    }
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string_view>
+
+#include "format.hpp"
+#include "timeZone.hpp"
+
+/**
+ * @brief The step between two instants of a range: a fixed number of seconds, or of calendar days or months.
+ */
+struct RangeStep
+{
+    std::int64_t seconds = 0; // Length of the step in seconds, for steps of fixed length
+    int days             = 0; // Length of the step in days, for calendar steps (days and weeks)
+    int months           = 0; // Length of the step in months, for calendar steps (months and years)
+};
+
+/**
+ * @brief A range of instants, from a start to an end included, every step.
+ */
+struct DateRange
+{
+    timespec start = {};    // First instant of the range
+    timespec end   = {};    // Last instant the range may reach
+    RangeStep step;         // Step between two instants
+    bool isValid   = false; // Indicates that the range was parsed
+};
+
+/**
+ * @class Range
+ * @brief Generates every instant of a range, formatted, e.g. a partition name for every hour of a year.
+ *
+ * Instants aren't broken down one by one: the fields of the first one are moved by each step (see
+ * `shiftBreakDown()`), which only computes the date again when the step crosses midnight, and only the
+ * fields that changed are rendered again (see `IncrementalFormat`). The lines are written in large blocks.
+ */
+class Range
+{
+private:
+    static constexpr size_t BLOCK_SIZE = 1024 * 1024; // Size of the blocks written to the output
+
+public:
+    /**
+     * @brief Parses a step: a positive number followed by a unit.
+     *
+     * The units are `s` (seconds, the default), `m` (minutes), `h` (hours), `d` (days), `w` (weeks),
+     * `M` (months) and `y` (years).
+     *
+     * @param text The step (e.g., "30", "1h", "7d", "3M").
+     * @return The step, empty if the text isn't valid.
+     */
+    static auto ParseStep(std::string_view) -> RangeStep;
+
+    /**
+     * @brief Parses a range given as `start/end/step`.
+     *
+     * The start and the end are ISO 8601 timestamps (see `Parser::ScanIso8601()`), or dates alone for
+     * midnight, local times of the given zone unless they have an offset.
+     *
+     * @param text The range (e.g., "2024-01-01/2024-12-31T23:00:00/1h").
+     * @param zone The zone the start and end are local times of, unless they say otherwise.
+     * @return The range, which `isValid` member is cleared if the text isn't valid.
+     */
+    static auto Parse(std::string_view, const TimeZone&) -> DateRange;
+
+    /**
+     * @brief Writes every instant of a range, formatted, each followed by a newline.
+     *
+     * Steps of fixed length move the instant by that many seconds. Calendar steps move the local date by
+     * days or months, keeping the local time of the day across changes of offset, the day of the month of
+     * the start being reduced to the length of shorter months (January 31st, February 29th, March 31st, ...).
+     *
+     * @param output The file descriptor the instants are written to.
+     * @param program The compiled format, see `Parser::CompileFormat()`.
+     * @param zone The zone the instants are printed in.
+     * @param range The range.
+     * @return True if everything was written, false otherwise.
+     */
+    static auto Generate(int, const FormatProgram&, const TimeZone&, const DateRange&) -> bool;
+};
@@ -0,0 +1,99 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <string_view>
+
+/**
+ * @struct Snapshot
+ * @brief All the broken-down fields of an instant, captured at once.
+ *
+ * A snapshot is a plain value: its accessors have the same names as the ones of ClockInterface, but they
+ * aren't virtual and are defined inline, so `Parser::RenderFormat()` reads each field straight from the
+ * struct instead of going through a virtual call.
+ *
+ * The time zone abbreviation is only a view: it stays valid as long as the clock the snapshot was taken
+ * from isn't moved to another instant or destroyed.
+ *
+ * @see Clock::getSnapshot
+ */
+struct Snapshot
+{
+    int year         = 0;      // Full year (e.g., 2025)
+    int month        = 0;      // Month (0 = January, 11 = December)
+    int day          = 1;      // Day of the month (1–31)
+    int hour         = 0;      // Hour of the day (0–23)
+    int minute       = 0;      // Minute of the hour (0–59)
+    int second       = 0;      // Second of the minute (0–60)
+    int nanosecond   = 0;      // Nanosecond of the second (0–999999999)
+    int dayOfTheWeek = 0;      // Day of the week (0 = Sunday, 6 = Saturday)
+    std::string_view timeZone; // Timezone abbreviation (e.g., "UTC", "CEST"), empty if it wasn't captured
+
+    constexpr auto getYear() const -> int
+    {
+        return year;
+    }
+
+    constexpr auto getMonth() const -> int
+    {
+        return month;
+    }
+
+    constexpr auto getDay() const -> int
+    {
+        return day;
+    }
+
+    constexpr auto getHour() const -> int
+    {
+        return hour;
+    }
+
+    constexpr auto getMin() const -> int
+    {
+        return minute;
+    }
+
+    constexpr auto getSec() const -> int
+    {
+        return second;
+    }
+
+    constexpr auto getNanosecond() const -> int
+    {
+        return nanosecond;
+    }
+
+    constexpr auto getDayOfTheWeek() const -> int
+    {
+        return dayOfTheWeek;
+    }
+
+    constexpr auto getTimeZone() const -> std::string_view
+    {
+        return timeZone;
+    }
+};
@@ -0,0 +1,74 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "format.hpp"
+#include "timeZone.hpp"
+
+/**
+ * @class Stamper
+ * @brief Prefixes each line of a stream with the formatted time it was read at.
+ *
+ * The input is read in large blocks and every line of a block is stamped with the time of the read that
+ * brought its first byte: the clock is read once per block, not once per line. The prefix is only
+ * rendered again when that time moves to another unit of the format's resolution (the second, or the
+ * last digit of `%N`), otherwise the previous prefix is copied as it is.
+ *
+ * Newlines are found with `memchr()`, which the C library vectorizes, and the output of a whole block is
+ * sent in a single write, so the filter mostly runs at the speed of copying memory.
+ */
+class Stamper
+{
+private:
+    static constexpr size_t BLOCK_SIZE                   = 1024 * 1024; // Size of the blocks read from the input
+    static constexpr std::int64_t NANOSECONDS_PER_SECOND = 1000000000;  // Nanoseconds in a second
+
+public:
+    /**
+     * @brief Returns the smallest change of time a compiled format can show.
+     *
+     * @param program The compiled format, see `Parser::CompileFormat()`.
+     * @return A second, or a smaller power of ten if the format holds `%N`, in nanoseconds.
+     */
+    static auto Resolution(const FormatProgram&) -> std::int64_t;
+
+    /**
+     * @brief Copies a file descriptor to another, prefixing each line with the formatted time.
+     *
+     * A last line without a newline is copied without one. Lines may be of any length.
+     *
+     * @param input The file descriptor the lines are read from.
+     * @param output The file descriptor the stamped lines are written to.
+     * @param prefix The compiled format of the prefix, see `Parser::CompileFormat()`.
+     * @param zone The zone the time is printed in.
+     * @param isCoarse If true, reads the coarse real-time clock; otherwise, the precise one.
+     * @return True if everything was read and written, false otherwise.
+     */
+    static auto PrefixLines(int, int, const FormatProgram&, const TimeZone&, bool) -> bool;
+};
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+#include <string_view>
+
+#include "format.hpp"
+#include "timeZone.hpp"
+
+/**
+ * @class Ticker
+ * @brief Prints the formatted time at a fixed interval, aligned on wall-clock boundaries.
+ *
+ * The ticks fall on multiples of the interval since the Epoch: every second on the second, every minute
+ * on the minute, and so on. Each tick sleeps until an absolute deadline with `clock_nanosleep()`, so the
+ * time spent formatting and writing never accumulates into a drift, and a sleep interrupted by a signal
+ * simply resumes towards the same deadline.
+ *
+ * The compiled format, the zone and the rendered text are kept for the whole run: each tick only renders
+ * the fields that changed since the previous one.
+ */
+class Ticker
+{
+private:
+    static constexpr std::int64_t NANOSECONDS_PER_SECOND = 1000000000; // Nanoseconds in a second
+
+    /**
+     * @brief Returns the first boundary strictly after a given time.
+     *
+     * @param now The time, in seconds and nanoseconds since the Epoch.
+     * @param interval The interval between two ticks, in nanoseconds.
+     * @return The boundary, in nanoseconds since the Epoch.
+     */
+    static auto nextTick(timespec now, std::int64_t interval) -> std::int64_t;
+
+public:
+    /**
+     * @brief Parses an interval given in seconds, with an optional fraction (e.g. "1", "0.5", "60").
+     *
+     * @param text The interval.
+     * @return The interval in nanoseconds, or 0 if the text isn't a positive number of seconds.
+     */
+    static auto ParseInterval(std::string_view) -> std::int64_t;
+
+    /**
+     * @brief Prints the formatted time at each tick, each time followed by a newline.
+     *
+     * The first tick is the first boundary after the call. If the process falls behind by more than an
+     * interval (e.g. the system was suspended), the missed ticks are skipped rather than printed in a burst.
+     * Each tick shows the time of its boundary, not the slightly later time the process woke up at.
+     *
+     * @param output The file descriptor the ticks are written to.
+     * @param program The compiled format, see `Parser::CompileFormat()`.
+     * @param zone The zone the time is printed in.
+     * @param interval The interval between two ticks, in nanoseconds.
+     * @param count The number of ticks to print, 0 to print them until an error occurs.
+     * @return True if all the ticks were printed, false if writing or sleeping failed.
+     */
+    static auto Run(int, const FormatProgram&, const TimeZone&, std::int64_t, std::uint64_t) -> bool;
+};
@@ -0,0 +1,215 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "calendar.hpp"
+
+/**
+ * @brief Reasons a time operand can be rejected for.
+ */
+enum class OperandError : std::uint8_t
+{
+    None    = 0,  // The operand is valid
+    Length  = 1,  // The operand doesn't have one of the accepted lengths
+    Digit   = 2,  // A character other than a digit was found where a digit was expected
+    Month   = 3,  // The month isn't in the range 01–12
+    Day     = 4,  // The day doesn't exist in the month
+    Hour    = 5,  // The hour isn't in the range 00–23
+    Minute  = 6,  // The minute isn't in the range 00–59
+    Second  = 7,  // The second isn't in the range 00–60
+    Literal = 8,  // The text doesn't match the literal text of the format
+    Name    = 9,  // A day or month name isn't one of the known ones
+    Zone    = 10  // The time zone abbreviation or UTC offset is invalid
+};
+
+/**
+ * @brief The fields of a `MMDDhhmm[[CC]YY][.SS]` time operand, once validated.
+ */
+struct TimeOperand
+{
+    int year           = 0;                  // Full year (e.g., 2025)
+    unsigned month     = 1;                  // Month (1 = January, 12 = December)
+    int day            = 1;                  // Day of the month (1–31)
+    int hour           = 0;                  // Hour of the day (0–23)
+    int minute         = 0;                  // Minute of the hour (0–59)
+    int second         = 0;                  // Second of the minute (0–60)
+    OperandError error = OperandError::None; // Why the operand was rejected, if it was
+};
+
+/**
+ * @brief Returns a short description of an operand error, suitable for an error message.
+ *
+ * @param error The error.
+ * @return The description (e.g., "invalid month").
+ */
+constexpr auto describeOperandError(OperandError error) -> std::string_view
+{
+    switch (error)
+    {
+    case OperandError::None:
+        return "valid";
+    case OperandError::Length:
+        return "invalid length";
+    case OperandError::Digit:
+        return "invalid digit";
+    case OperandError::Month:
+        return "invalid month";
+    case OperandError::Day:
+        return "invalid day";
+    case OperandError::Hour:
+        return "invalid hour";
+    case OperandError::Minute:
+        return "invalid minute";
+    case OperandError::Second:
+        return "invalid second";
+    case OperandError::Literal:
+        return "text doesn't match the format";
+    case OperandError::Name:
+        return "invalid day or month name";
+    case OperandError::Zone:
+        return "invalid time zone";
+    }
+
+    return "invalid operand";
+}
+
+/**
+ * @brief Checks the ranges of the fields of a time operand.
+ *
+ * @param operand The fields, the year, month and day being checked together.
+ * @return The first field out of its range, or `OperandError::None`.
+ */
+constexpr auto checkOperandFields(const TimeOperand& operand) -> OperandError
+{
+    if (operand.month < 1 || operand.month > 12)
+    {
+        return OperandError::Month;
+    }
+
+    if (operand.day < 1 || static_cast<unsigned>(operand.day) > daysInMonth(operand.year, operand.month))
+    {
+        return OperandError::Day;
+    }
+
+    if (operand.hour < 0 || operand.hour > 23)
+    {
+        return OperandError::Hour;
+    }
+
+    if (operand.minute < 0 || operand.minute > 59)
+    {
+        return OperandError::Minute;
+    }
+
+    if (operand.second < 0 || operand.second > 60)
+    {
+        return OperandError::Second;
+    }
+
+    return OperandError::None;
+}
+
+/**
+ * @brief Parses a POSIX `MMDDhhmm[[CC]YY][.SS]` time operand, as taken by `date` and `touch -t`-like utilities.
+ *
+ * The operand is checked and converted in a single pass over its fixed-width digit pairs, the ranges being
+ * checked on the integers. Nothing is allocated and nothing is thrown: a rejected operand is reported
+ * through `TimeOperand::error`.
+ *
+ * A two-digit year is taken in 1969–2068, as POSIX requires. Without a year, the current one is used.
+ *
+ * @param operand The operand (e.g., "07041230", "0704123025.45", "070412302025").
+ * @param currentYear The year used when the operand has none.
+ * @return The fields of the operand, or the reason it was rejected.
+ */
+constexpr auto parseTimeOperand(std::string_view operand, int currentYear) -> TimeOperand
+{
+    TimeOperand result;                // Fields being parsed
+    size_t digits    = operand.size(); // Number of digits before the seconds
+    bool hasSeconds  = false;          // Indicates that the operand ends with .SS
+    unsigned invalid = 0;              // Non-zero once a character isn't a digit
+
+    if (digits >= 3 && operand[digits - 3] == '.')
+    {
+        digits -= 3;
+        hasSeconds = true;
+    }
+
+    if (digits != 8 && digits != 10 && digits != 12)
+    {
+        result.error = OperandError::Length;
+        return result;
+    }
+
+    // Every character but the dot must be a digit
+    for (size_t i = 0; i < operand.size(); i++)
+    {
+        invalid |= (i != digits || !hasSeconds) && static_cast<unsigned>(operand[i] - '0') > 9 ? 1U : 0U;
+    }
+
+    if (invalid != 0)
+    {
+        result.error = OperandError::Digit;
+        return result;
+    }
+
+    // Value of the digit pair at a position
+    auto pair = [operand](size_t position)
+    {
+        return (operand[position] - '0') * 10 + (operand[position + 1] - '0');
+    };
+
+    result.month  = static_cast<unsigned>(pair(0));
+    result.day    = pair(2);
+    result.hour   = pair(4);
+    result.minute = pair(6);
+    result.second = hasSeconds ? pair(digits + 1) : 0;
+
+    switch (digits)
+    {
+    case 12:
+        result.year = pair(8) * 100 + pair(10);
+        break;
+    case 10:
+        result.year = pair(8) + (pair(8) < 69 ? 2000 : 1900);
+        break;
+    default:
+        result.year = currentYear;
+        break;
+    }
+
+    result.error = checkOperandFields(result);
+
+    return result;
+}
+
+static_assert(parseTimeOperand("0229120024", 2023).error == OperandError::None, "2024 is a leap year");
+static_assert(parseTimeOperand("0229120023", 2024).error == OperandError::Day, "2023 isn't a leap year");
+static_assert(parseTimeOperand("1231235968.60", 0).year == 2068 && parseTimeOperand("010100006901", 0).year == 6901, "Years");
@@ -0,0 +1,228 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief One of the local time types of a zone, e.g. CET or CEST.
+ */
+struct ZoneType
+{
+    std::int32_t offset     = 0;     // Offset from UTC, in seconds east of Greenwich
+    bool isDst              = false; // Indicates that the type is daylight saving time
+    std::uint32_t nameIndex = 0;     // Position of the abbreviation in TimeZone::abbreviations
+};
+
+/**
+ * @brief A span of time during which the offset and abbreviation of a zone don't change.
+ *
+ * Callers converting many instants can keep the last period and only look the zone up again once an
+ * instant falls outside of it.
+ */
+struct ZonePeriod
+{
+    std::int64_t begin  = std::numeric_limits<std::int64_t>::min(); // First instant of the period, in seconds since the Epoch
+    std::int64_t end    = std::numeric_limits<std::int64_t>::min(); // First instant after the period, empty by default
+    std::int32_t offset = 0;                                        // Offset from UTC during the period, in seconds east of Greenwich
+    bool isDst          = false;                                    // Indicates that the period is daylight saving time
+    std::string_view abbreviation;                                  // Timezone abbreviation during the period (e.g., "CEST")
+
+    /**
+     * @brief Checks whether an instant falls within the period.
+     *
+     * @param instant The instant, in seconds since the Epoch.
+     * @return True if the instant is in [begin, end), false otherwise.
+     */
+    constexpr auto contains(std::int64_t instant) const -> bool
+    {
+        return instant >= begin && instant < end;
+    }
+};
+
+/**
+ * @brief The day of the year a POSIX TZ rule changes time, e.g. `M3.5.0` for the last Sunday of March.
+ */
+struct RuleDate
+{
+    char kind         = 'M';  // 'J' for a day of a non-leap year (1–365), 'D' for a day of the year (0–365), 'M' for a weekday of a month
+    int day           = 0;    // Day of the year for 'J' and 'D', day of the week (0 = Sunday) for 'M'
+    int week          = 0;    // For 'M', week of the month (1–5, 5 being the last one)
+    int month         = 0;    // For 'M', month (1 = January, 12 = December)
+    std::int32_t time = 7200; // Local time of the change, in seconds after midnight (may be negative or over a day)
+};
+
+/**
+ * @class TimeZone
+ * @brief Converts instants to local time, reading zone data straight from TZif files.
+ *
+ * A zone is loaded from a compiled TZif file (RFC 8536), which is mapped in memory and copied into a
+ * compact sorted array of transitions, or from a POSIX TZ string such as `CET-1CEST,M3.5.0,M10.5.0/3`.
+ * Looking an instant up is a binary search in the transitions, falling back to the POSIX rule found at
+ * the end of the file past the last transition. No time zone database is involved.
+ *
+ * A default constructed zone is UTC. A loaded zone is never modified by lookups, so it can be shared
+ * between any number of threads.
+ */
+class TimeZone
+{
+private:
+    std::vector<std::int64_t> transitions;     // Instants the local time type changes at, in increasing order
+    std::vector<std::uint8_t> transitionTypes; // Index in types of the type in effect from each transition on
+    std::vector<ZoneType> types;               // Local time types of the zone, the first one applying before any transition
+    std::string abbreviations;                 // Abbreviations of the types, each one followed by a null character
+    bool hasRule = false;                      // Indicates that the rule* members describe the local time after the last transition
+    ZoneType ruleStandard;                     // Standard time type of the rule
+    ZoneType ruleDaylight;                     // Daylight saving time type of the rule, if it has one
+    bool ruleHasDst = false;                   // Indicates that the rule switches between standard and daylight saving time
+    RuleDate ruleStart;                        // Date daylight saving time starts, in standard time
+    RuleDate ruleEnd;                          // Date daylight saving time ends, in daylight saving time
+
+    /**
+     * @brief Reads the transitions, types and POSIX TZ string of TZif data.
+     *
+     * @param data The content of a TZif file.
+     * @return True if the data is valid, false otherwise.
+     */
+    auto parseData(std::string_view data) -> bool;
+
+    /**
+     * @brief Reads a POSIX TZ string into the rule of the zone, appending its abbreviations.
+     *
+     * @param rule The TZ string.
+     * @return True if the string is valid, false otherwise.
+     */
+    auto parseRule(std::string_view rule) -> bool;
+
+    /**
+     * @brief Builds a period from a local time type.
+     *
+     * @param begin First instant of the period.
+     * @param end First instant after the period.
+     * @param type Local time type in effect during the period.
+     * @return The period.
+     */
+    auto makePeriod(std::int64_t begin, std::int64_t end, const ZoneType& type) const -> ZonePeriod;
+
+    /**
+     * @brief Looks an instant up with the POSIX rule of the zone.
+     *
+     * @param instant The instant, in seconds since the Epoch.
+     * @param notBefore Earliest beginning of the period, the last transition of the file.
+     * @return The period holding the instant.
+     */
+    auto findWithRule(std::int64_t instant, std::int64_t notBefore) const -> ZonePeriod;
+
+    /**
+     * @brief Returns the instant a rule date falls on in a given year.
+     *
+     * @param date The rule date.
+     * @param year The full year.
+     * @param offset The offset in effect before the change, in seconds east of Greenwich.
+     * @return The instant of the change, in seconds since the Epoch.
+     */
+    static auto ruleInstant(const RuleDate& date, std::int64_t year, std::int32_t offset) -> std::int64_t;
+
+public:
+    /**
+     * @brief Default constructor. The zone is UTC until something is loaded.
+     */
+    TimeZone();
+
+    /**
+     * @brief Returns a shared UTC zone.
+     *
+     * @return The UTC zone.
+     */
+    static auto Utc() -> const TimeZone&;
+
+    /**
+     * @brief Returns the local time zone of the process.
+     *
+     * The zone is loaded on the first call, then shared by all the callers. It follows the TZ environment
+     * variable when set, see `loadName()`, an invalid TZ meaning UTC. When TZ isn't set, /etc/localtime is
+     * used, or UTC if it can't be loaded.
+     *
+     * @return The local time zone.
+     */
+    static auto Local() -> const TimeZone&;
+
+    /**
+     * @brief Loads a compiled TZif file.
+     *
+     * The file is mapped in memory and parsed in place, using the 64-bit data of version 2 and later files.
+     *
+     * @param path The path of the file.
+     * @return True if the file was loaded, false if it can't be read or isn't a valid TZif file, in which
+     *         case the zone is left unchanged.
+     */
+    auto load(const std::string& path) -> bool;
+
+    /**
+     * @brief Loads a POSIX TZ string, e.g. `EST5EDT,M3.2.0,M11.1.0`.
+     *
+     * When daylight saving time is named without a rule, the United States rule is used.
+     *
+     * @param rule The TZ string.
+     * @return True if the string was loaded, false if it isn't valid, in which case the zone is left unchanged.
+     */
+    auto loadRule(std::string_view rule) -> bool;
+
+    /**
+     * @brief Loads a zone the way the TZ environment variable designates it.
+     *
+     * The value is an absolute path or a name under the zoneinfo directory ($TZDIR, or /usr/share/zoneinfo),
+     * with an optional leading `:`, or else a POSIX TZ string. An empty value means UTC.
+     *
+     * @param value The zone, e.g. "Europe/Paris", ":/etc/localtime" or "EST5EDT".
+     * @return True if the zone was loaded, false if it can't be, in which case the zone is left unchanged.
+     */
+    auto loadName(std::string_view value) -> bool;
+
+    /**
+     * @brief Looks up the offset and abbreviation of the zone at an instant.
+     *
+     * @param instant The instant, in seconds since the Epoch.
+     * @return The period of constant offset and abbreviation holding the instant.
+     */
+    auto find(std::int64_t instant) const -> ZonePeriod;
+
+    /**
+     * @brief Converts a local time of the zone to the instant it designates.
+     *
+     * Around a change of offset, the offset in effect a moment earlier is the one used: a local time skipped
+     * by a change forward is moved past it, and a local time repeated by a change backward is taken the first
+     * time it occurs.
+     *
+     * @param localSeconds The local time, in seconds since the Epoch as if it were UTC (see `secondsFromCivil()`).
+     * @return The instant, in seconds since the Epoch.
+     */
+    auto fromLocal(std::int64_t localSeconds) const -> std::int64_t;
+};
@@ -0,0 +1,47 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#pragma once
+
+#include <string_view>
+
+/**
+ * @class Writer
+ * @brief Writes output to a file descriptor, whatever the number of system calls it takes.
+ */
+class Writer
+{
+public:
+    /**
+     * @brief Writes a string to the file descriptor.
+     *
+     * Short writes and interruptions by a signal are resumed where they stopped.
+     *
+     * @param descriptor The file descriptor to write to.
+     * @param text The bytes to write.
+     * @return True if everything was written, false if an error occurred (errno is set accordingly).
+     */
+    static auto Write(int, std::string_view) -> bool;
+};
@@ -0,0 +1,229 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <unistd.h>
+
+#include "batch.hpp"
+#include "clock.hpp"
+#include "digits.hpp"
+#include "parser.hpp"
+#include "snapshot.hpp"
+#include "timeOperand.hpp"
+#include "timeZone.hpp"
+#include "writer.hpp"
+
+using std::cerr;
+using std::copy;
+using std::errc;
+using std::from_chars;
+using std::to_chars;
+using std::string;
+using std::string_view;
+using std::vector;
+
+namespace
+{
+constexpr size_t BLOCK_SIZE           = 1024 * 1024; // Size of the blocks read from the input and written to the output
+constexpr long NANOSECONDS_PER_SECOND = 1000000000;  // Nanoseconds in a second
+
+// Formats the epoch value held by a line, returning false if the line doesn't hold one
+auto FormatLine(string_view line, Clock& clock, const FormatProgram& program, string& formatted) -> bool
+{
+    time_t instant = 0; // Value read from the line
+
+    // Surrounding blanks are ignored, including the carriage return of CRLF line endings
+    while (!line.empty() && (line.front() == ' ' || line.front() == '\t'))
+    {
+        line.remove_prefix(1);
+    }
+
+    while (!line.empty() && (line.back() == ' ' || line.back() == '\t' || line.back() == '\r'))
+    {
+        line.remove_suffix(1);
+    }
+
+    auto [end, error] = from_chars(line.data(), line.data() + line.size(), instant);
+
+    if (line.empty() || error != errc() || end != line.data() + line.size())
+    {
+        cerr << "Invalid epoch value: " << line << "\n";
+        return false;
+    }
+
+    // The fields are read from a snapshot, without any virtual call
+    clock.setInstant(instant);
+    Parser::RenderFormat(program, clock.getSnapshot(), formatted);
+    formatted += '\n';
+
+    return true;
+}
+
+// Reads the formatted date held by a line and appends its epoch value, returning false if the line doesn't hold one
+auto ScanLine(string_view line, bool isIso8601, const FormatProgram& program, const TimeZone& zone, string& converted) -> bool
+{
+    std::array<char, 32> digits = {}; // Text of the epoch value
+
+    // The carriage return of CRLF line endings is ignored
+    if (!line.empty() && line.back() == '\r')
+    {
+        line.remove_suffix(1);
+    }
+
+    const DateResult date = isIso8601 ? Parser::ScanIso8601(line, zone) : Parser::ScanFormat(program, line, zone);
+
+    if (date.error != OperandError::None)
+    {
+        cerr << "Invalid date " << line << ": " << describeOperandError(date.error) << "\n";
+        return false;
+    }
+
+    // A fraction is written as such, a negative instant counting it towards the Epoch
+    const bool isNegative = date.time.tv_sec < 0 && date.time.tv_nsec != 0;
+    const time_t seconds  = isNegative ? date.time.tv_sec + 1 : date.time.tv_sec;
+
+    if (isNegative && seconds == 0)
+    {
+        converted += '-';
+    }
+
+    converted.append(digits.data(), to_chars(digits.data(), digits.data() + digits.size(), seconds).ptr);
+
+    if (date.time.tv_nsec != 0)
+    {
+        const long nanosecond = isNegative ? NANOSECONDS_PER_SECOND - date.time.tv_nsec : date.time.tv_nsec;
+
+        converted += '.';
+        writeDigits(digits.data(), static_cast<unsigned>(nanosecond), FRACTION_DIGITS);
+        converted.append(digits.data(), FRACTION_DIGITS);
+    }
+
+    converted += '\n';
+
+    return true;
+}
+
+// Converts every line read from a file descriptor and writes the results to another, in large blocks
+template <typename Convert>
+auto ConvertLines(int input, int output, Convert convert) -> bool
+{
+    vector<char> buffer(BLOCK_SIZE); // Input read so far, the last line may be incomplete
+    string converted;                // Output waiting to be written
+    size_t used  = 0;                // Bytes of the buffer holding input
+    bool isValid = true;             // Cleared as soon as a line can't be converted
+
+    converted.reserve(2 * BLOCK_SIZE);
+
+    while (true)
+    {
+        // A single line fills the whole buffer, so it has to grow
+        if (used == buffer.size())
+        {
+            buffer.resize(2 * buffer.size());
+        }
+
+        ssize_t count = read(input, buffer.data() + used, buffer.size() - used);
+
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            cerr << "Can't read the input: " << strerror(errno) << "\n";
+            return false;
+        }
+
+        used += static_cast<size_t>(count);
+
+        size_t start = 0; // Beginning of the line being looked at
+
+        // Converts every complete line of the buffer
+        while (const auto* newline = static_cast<const char*>(memchr(buffer.data() + start, '\n', used - start)))
+        {
+            auto end = static_cast<size_t>(newline - buffer.data());
+
+            isValid = convert(string_view(buffer.data() + start, end - start), converted) && isValid;
+            start   = end + 1;
+
+            if (converted.size() >= BLOCK_SIZE)
+            {
+                if (!Writer::Write(output, converted))
+                {
+                    return false;
+                }
+
+                converted.clear();
+            }
+        }
+
+        // The end of the input has been reached, the last line may lack its newline
+        if (count == 0)
+        {
+            if (start < used)
+            {
+                isValid = convert(string_view(buffer.data() + start, used - start), converted) && isValid;
+            }
+
+            break;
+        }
+
+        // Keeps the incomplete line at the beginning of the buffer, for the next read to complete it
+        copy(buffer.begin() + static_cast<std::ptrdiff_t>(start), buffer.begin() + static_cast<std::ptrdiff_t>(used), buffer.begin());
+        used -= start;
+    }
+
+    return Writer::Write(output, converted) && isValid;
+}
+} // namespace
+
+auto Batch::FormatEpochs(int input, int output, const FormatProgram& program, bool isUtc) -> bool
+{
+    Clock clock(0, isUtc); // Moved to each value in turn
+
+    return ConvertLines(input, output, [&clock, &program](string_view line, string& formatted)
+                        { return FormatLine(line, clock, program, formatted); });
+}
+
+auto Batch::ScanDates(int input, int output, const FormatProgram& program, const TimeZone& zone) -> bool
+{
+    const bool isIso8601 = Parser::IsIso8601(program); // Indicates that the fast path can read the dates
+
+    return ConvertLines(input, output, [isIso8601, &program, &zone](string_view line, string& converted)
+                        { return ScanLine(line, isIso8601, program, zone, converted); });
+}
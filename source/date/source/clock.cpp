@@ -23,85 +23,128 @@
  *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
  */
 
-#include <chrono>
 #include <cstdlib>
 #include <ctime>
-#include <format>
 #include <string>
 
 #include <sys/select.h>
 
+#include "calendar.hpp"
 #include "clock.hpp"
 #include "day.hpp"
 #include "month.hpp"
+#include "snapshot.hpp"
+#include "timeZone.hpp"
 
-using duration = std::chrono::system_clock::duration;
-using std::chrono::current_zone;
-using std::chrono::system_clock;
-using std::chrono::zoned_time;
 using std::exit;
 using std::string;
 
-Clock::Clock() : now(0), time(nullptr), day(Day::Monday), month(Month::January) {}
+Clock::Clock() : now(0), fields(), zone(&TimeZone::Utc()), period(), day(Day::Monday), month(Month::January) {}
 
-Clock::Clock(bool isUtc)
+Clock::Clock(bool isUtc) : Clock(readTime(false), isUtc ? TimeZone::Utc() : TimeZone::Local()) {}
+
+Clock::Clock(time_t instant, bool isUtc) : Clock(instant, isUtc ? TimeZone::Utc() : TimeZone::Local()) {}
+
+Clock::Clock(time_t instant, const TimeZone& zone) : now(instant), fields(), zone(&zone), period(), day(Day::Sunday), month(Month::January)
 {
-    now = system_clock::to_time_t(system_clock::now());
+    setInstant(instant);
+}
 
-    if (isUtc)
-    {
-        time     = gmtime(&now);
-        timeZone = "UTC";
-    }
-    else
+Clock::Clock(timespec instant, const TimeZone& zone) : Clock(instant.tv_sec, zone)
+{
+    fields.nanosecond = static_cast<int>(instant.tv_nsec);
+}
+
+void Clock::setInstant(timespec instant)
+{
+    setInstant(instant.tv_sec);
+    fields.nanosecond = static_cast<int>(instant.tv_nsec);
+}
+
+void Clock::setInstant(time_t instant)
+{
+    now = instant;
+
+    // The zone is only searched again once the instant leaves the period of the previous one
+    if (!period.contains(now))
     {
-        time = localtime(&now);
-        zoned_time<duration> zonedTime(current_zone(), system_clock::from_time_t(now));
-        timeZone = std::format("{:%Z}", zonedTime);
+        period = zone->find(now);
     }
 
-    day   = static_cast<Day>(time->tm_wday);
-    month = static_cast<Month>(time->tm_mon);
+    fields          = breakDown(now + period.offset);
+    fields.timeZone = period.abbreviation;
+
+    day   = static_cast<Day>(fields.dayOfTheWeek);
+    month = static_cast<Month>(fields.month);
 }
 
 auto Clock::getYear() const -> int
 {
-    return TM_YEAR_BASE + time->tm_year;
+    return fields.year;
 }
 
 auto Clock::getMonth() const -> int
 {
-    return time->tm_mon;
+    return fields.month;
 }
 
 auto Clock::getDay() const -> int
 {
-    return time->tm_mday;
+    return fields.day;
 }
 
 auto Clock::getHour() const -> int
 {
-    return time->tm_hour;
+    return fields.hour;
 }
 
 auto Clock::getMin() const -> int
 {
-    return time->tm_min;
+    return fields.minute;
 }
 
 auto Clock::getSec() const -> int
 {
-    return time->tm_sec;
+    return fields.second;
+}
+
+auto Clock::getNanosecond() const -> int
+{
+    return fields.nanosecond;
 }
 
 auto Clock::getDayOfTheWeek() const -> int
 {
-    return time->tm_wday;
+    return fields.dayOfTheWeek;
 }
 
 auto Clock::getTimeZone() const -> string
 {
-    return timeZone;
+    return string(fields.timeZone);
+}
+
+auto Clock::getSnapshot() const -> Snapshot
+{
+    return fields;
+}
+
+auto Clock::readTime(bool isCoarse) -> timespec
+{
+    timespec now   = {};             // Current time
+    clockid_t type = CLOCK_REALTIME; // Clock being read
+
+#ifdef CLOCK_REALTIME_COARSE
+    if (isCoarse)
+    {
+        type = CLOCK_REALTIME_COARSE;
+    }
+#else
+    (void)isCoarse;
+#endif
+
+    clock_gettime(type, &now);
+
+    return now;
 }
 
 void Clock::setTime(timespec* newTime)
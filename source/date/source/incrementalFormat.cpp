@@ -0,0 +1,126 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include "format.hpp"
+#include "incrementalFormat.hpp"
+#include "parser.hpp"
+#include "snapshot.hpp"
+
+using std::string_view;
+
+IncrementalFormat::IncrementalFormat(FormatProgram program) : program(std::move(program)), starts(this->program.tokens.size() + 1, 0) {}
+
+auto IncrementalFormat::update(const Snapshot& fields) -> string_view
+{
+    if (!isRendered)
+    {
+        renderFrom(0, fields);
+        isRendered = true;
+        previous   = fields;
+
+        return rendered;
+    }
+
+    for (size_t i = 0; i < program.tokens.size(); i++)
+    {
+        const Token& token = program.tokens[i];
+
+        if (!hasChanged(token, previous, fields))
+        {
+            continue;
+        }
+
+        scratch.clear();
+        Parser::RenderToken(program, token, fields, scratch);
+
+        // The rest of the text moves if the width changed, so it is all rendered again
+        if (scratch.size() != starts[i + 1] - starts[i])
+        {
+            renderFrom(i, fields);
+            break;
+        }
+
+        rendered.replace(starts[i], scratch.size(), scratch);
+    }
+
+    previous = fields;
+
+    return rendered;
+}
+
+void IncrementalFormat::renderFrom(size_t first, const Snapshot& fields)
+{
+    rendered.resize(starts[first]);
+
+    for (size_t i = first; i < program.tokens.size(); i++)
+    {
+        starts[i] = rendered.size();
+        Parser::RenderToken(program, program.tokens[i], fields, rendered);
+    }
+
+    starts.back() = rendered.size();
+}
+
+auto IncrementalFormat::hasChanged(const Token& token, const Snapshot& before, const Snapshot& after) -> bool
+{
+    switch (token.opcode)
+    {
+    case Opcode::Literal:
+        return false;
+    case Opcode::ShortDay:
+    case Opcode::LongDay:
+        return before.dayOfTheWeek != after.dayOfTheWeek;
+    case Opcode::ShortMonth:
+    case Opcode::LongMonth:
+    case Opcode::Month:
+        return before.month != after.month;
+    case Opcode::Day:
+    case Opcode::DayNoPad:
+        return before.day != after.day;
+    case Opcode::Hour:
+        return before.hour != after.hour;
+    case Opcode::Minute:
+        return before.minute != after.minute;
+    case Opcode::HourMinute:
+        return before.hour != after.hour || before.minute != after.minute;
+    case Opcode::Second:
+        return before.second != after.second;
+    case Opcode::Time:
+        return before.hour != after.hour || before.minute != after.minute || before.second != after.second;
+    case Opcode::ShortYear:
+    case Opcode::Year:
+        return before.year != after.year;
+    case Opcode::TimeZone:
+        return before.timeZone != after.timeZone;
+    case Opcode::Fraction:
+        return before.nanosecond != after.nanosecond;
+    }
+
+    return true;
+}
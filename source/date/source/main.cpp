@@ -8,10 +8,17 @@
  *  supports timezone adjustments, allows custom output formats, and permits
  *  setting the system date and time when authorized.
  *
- *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *  Usage: ./date [-u] [-c] [-f file | -s file | -i interval | -p | -z zone... | -g range] [+format] [mmddhhmm[[cc]yy][.ss]]
  *
  *  Supported options:
  *    -u      : Display the date and time in "UTC0".
+ *    -c      : Read the coarse real-time clock, cheaper but only precise to the scheduler tick.
+ *    -f file : Format each epoch value (one per line) read from file, or from the standard input if file is "-".
+ *    -s file : Read each formatted date (one per line, in the +format) from file back into its epoch value.
+ *    -i secs : Print the time every interval seconds (e.g. 1, 0.5, 60), on wall-clock boundaries, until killed.
+ *    -z zone : Print the time in the given zone (named as in TZ) instead of the local one; repeat it for several zones.
+ *    -p      : Copy the standard input to the standard output, prefixing each line with the time and a space.
+ *    -g range : Print every instant from start to end (included) every step, the range being start/end/step (e.g. 2024-01-01/2024-12-31/1d).
  *
  *  Supported features:
  *    - Display the current date and time in local time or UTC (-u).
@@ -24,77 +31,191 @@
  */
 
 #include <cctype>
+#include <cstdint>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
+#include <span>
 #include <string>
-#include <vector>
 
+#include <fcntl.h>
 #include <getopt.h>
+#include <unistd.h>
 
+#include "batch.hpp"
 #include "clock.hpp"
+#include "multiZone.hpp"
 #include "parser.hpp"
+#include "range.hpp"
+#include "stamper.hpp"
+#include "ticker.hpp"
+#include "timeOperand.hpp"
+#include "timeZone.hpp"
+#include "writer.hpp"
 
 using std::cerr;
 using std::cout;
+using std::int64_t;
+using std::span;
 using std::string;
-using std::vector;
 
 auto main(int argc, char* argv[]) -> int
 {
-    vector<string> arguments(argv + 1, argv + argc); // Vector of arguments from command-line inputs
-    bool isUtc = false;                              // Indicates that the time should be printed in UTC instead of local time.
-    int opt    = 0;                                  // Result of getopt
-    Clock clock;                                     // Object for the clock
-    string formattedDate;                            // Formatted date
+    bool isUtc       = false;                      // Indicates that the time should be printed in UTC instead of local time.
+    bool isCoarse    = false;                      // Indicates that the coarse clock should be read instead of the precise one
+    int opt          = 0;                          // Result of getopt
+    bool isPrefix    = false;                      // Indicates that the lines of the standard input should be prefixed with the time
+    int64_t interval = 0;                          // Interval between two ticks in nanoseconds, 0 to print the time once
+    string inputFile;                              // File of epoch values to format, "-" for the standard input
+    string scanFile;                               // File of formatted dates to read back, "-" for the standard input
+    string format    = "+%a %b %e %H:%M:%S %Z %Y"; // Format of the output, the whole date if none is given
+    MultiZone zones;                               // Zones to print the time in, instead of the local one
+    string range;                                  // Range of instants to print, as start/end/step
 
     // Check if getop returns -1. If it does, handle the option
-    while ((opt = getopt(argc, argv, "u")) != -1)
+    while ((opt = getopt(argc, argv, "ucf:s:i:pz:g:")) != -1)
     {
         switch (opt)
         {
         case 'u':
             isUtc = true;
             break;
+        case 'c':
+            isCoarse = true;
+            break;
+        case 'f':
+            inputFile = optarg;
+            break;
+        case 's':
+            scanFile = optarg;
+            break;
+        case 'i':
+            interval = Ticker::ParseInterval(optarg);
+
+            if (interval == 0)
+            {
+                cerr << "Invalid interval " << optarg << ": expected a positive number of seconds\n";
+                return EXIT_FAILURE;
+            }
+
+            break;
+        case 'p':
+            isPrefix = true;
+            break;
+        case 'z':
+            if (!zones.add(optarg))
+            {
+                cerr << "Invalid time zone " << optarg << "\n";
+                return EXIT_FAILURE;
+            }
+
+            break;
+        case 'g':
+            range = optarg;
+            break;
         default:
             cerr << "Invalid option. Try -u if you want to set time in UTC.";
             return EXIT_FAILURE;
         }
     }
 
-    // if there are more than 3 arguments, prints the usage and terminates the program
-    if (arguments.size() > 3)
+    span<char*> operands(argv + optind, argc - optind); // Arguments left once the options have been handled
+
+    // if there are more than 2 operands, prints the usage and terminates the program
+    if (operands.size() > 2)
     {
-        cerr << "Usage : ./date [-u] [+format]";
+        cerr << "Usage : ./date [-u] [-c] [-f file | -s file | -i interval | -p | -z zone... | -g range] [+format]";
         return EXIT_FAILURE;
     }
 
-    clock = Clock(isUtc);
+    // Parse the operands. If one starts with a digit, it's to set the system date. Otherwise, it's the formatting argument
+    for (string argument : operands)
+    {
+        if (isdigit(argument.front()) != 0)
+        {
+            // With -u, the operand is a UTC time
+            const TimeZone& zone = isUtc ? TimeZone::Utc() : TimeZone::Local();
+            DateResult date      = Parser::ParseDate(argument, Clock(isUtc).getYear(), zone);
+
+            if (date.error != OperandError::None)
+            {
+                cerr << "Invalid date " << argument << ": " << describeOperandError(date.error) << "\n";
+                return EXIT_FAILURE;
+            }
+
+            Clock::setTime(&date.time);
+            return EXIT_SUCCESS;
+        }
 
-    // Parse the arguments. If one starts with +, it's the formatting argument. If one start with a digit, it's to set the system date
-    for (string argument : arguments)
+        format = argument;
+    }
+
+    // Formats every epoch value of the input instead of the current date
+    if (!inputFile.empty())
     {
-        if (argument == "-u")
+        int input = inputFile == "-" ? STDIN_FILENO : open(inputFile.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT(cppcoreguidelines-pro-type-vararg)
+
+        if (input < 0)
         {
-            continue;
+            cerr << "Can't open " << inputFile << "\n";
+            return EXIT_FAILURE;
         }
-        if (isdigit(argument.front()) != 0)
+
+        return Batch::FormatEpochs(input, STDOUT_FILENO, Parser::CompileFormat(format), isUtc) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // Reads every formatted date of the input back into its epoch value
+    if (!scanFile.empty())
+    {
+        int input = scanFile == "-" ? STDIN_FILENO : open(scanFile.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT(cppcoreguidelines-pro-type-vararg)
+
+        if (input < 0)
         {
-            Clock::setTime(Parser::ParseDate(argument).get());
-            return EXIT_SUCCESS;
+            cerr << "Can't open " << scanFile << "\n";
+            return EXIT_FAILURE;
         }
 
-        formattedDate = Parser::ParseFormat(argument, clock);
+        return Batch::ScanDates(input, STDOUT_FILENO, Parser::CompileFormat(format), isUtc ? TimeZone::Utc() : TimeZone::Local()) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // Stamps every line of the standard input with the time it was read at
+    if (isPrefix)
+    {
+        return Stamper::PrefixLines(STDIN_FILENO, STDOUT_FILENO, Parser::CompileFormat(format + " "), isUtc ? TimeZone::Utc() : TimeZone::Local(), isCoarse) ? EXIT_SUCCESS : EXIT_FAILURE;
     }
 
-    // If formattedDate is empty, no formatting argument has been passed so the whole date shall be printed
-    if (formattedDate.empty())
+    // Prints the time at each tick, until killed
+    if (interval != 0)
     {
-        string arg    = "+%a %b %e %H:%M:%S %Z %Y";
-        formattedDate = Parser::ParseFormat(arg, clock);
+        return Ticker::Run(STDOUT_FILENO, Parser::CompileFormat(format), isUtc ? TimeZone::Utc() : TimeZone::Local(), interval, 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // Prints every instant of the range, instead of the current one
+    if (!range.empty())
+    {
+        const TimeZone& zone   = isUtc ? TimeZone::Utc() : TimeZone::Local();
+        const DateRange bounds = Range::Parse(range, zone);
+
+        if (!bounds.isValid)
+        {
+            cerr << "Invalid range " << range << ": expected start/end/step (e.g. 2024-01-01/2024-12-31/1d)\n";
+            return EXIT_FAILURE;
+        }
+
+        return Range::Generate(STDOUT_FILENO, Parser::CompileFormat(format), zone, bounds) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // Prints the same instant in every zone, one line each
+    if (zones.size() != 0)
+    {
+        string output; // Lines of all the zones, written at once
+
+        zones.render(Clock::readTime(isCoarse), Parser::CompileFormat(format), output);
+
+        return Writer::Write(STDOUT_FILENO, output) ? EXIT_SUCCESS : EXIT_FAILURE;
     }
 
-    cout << formattedDate;
+    cout << Parser::ParseFormat(format, Clock(Clock::readTime(isCoarse), isUtc ? TimeZone::Utc() : TimeZone::Local()));
 
     return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
@@ -0,0 +1,82 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#include <cstddef>
+#include <ctime>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "calendar.hpp"
+#include "multiZone.hpp"
+#include "parser.hpp"
+#include "snapshot.hpp"
+#include "timeZone.hpp"
+
+using std::string;
+using std::string_view;
+
+auto MultiZone::add(string_view name) -> bool
+{
+    TimeZone zone; // Loaded before being added, so that a failure leaves the list unchanged
+
+    if (!zone.loadName(name))
+    {
+        return false;
+    }
+
+    zones.push_back(std::move(zone));
+
+    // The zones may have moved, and the abbreviations of their periods with them
+    periods.assign(zones.size(), ZonePeriod());
+
+    return true;
+}
+
+auto MultiZone::size() const -> size_t
+{
+    return zones.size();
+}
+
+void MultiZone::render(timespec instant, const FormatProgram& program, string& output)
+{
+    Snapshot utc = breakDown(instant.tv_sec); // The instant broken down once, shared by all the zones
+
+    utc.nanosecond = static_cast<int>(instant.tv_nsec);
+
+    for (size_t i = 0; i < zones.size(); i++)
+    {
+        if (!periods[i].contains(instant.tv_sec))
+        {
+            periods[i] = zones[i].find(instant.tv_sec);
+        }
+
+        Snapshot local = shiftBreakDown(utc, periods[i].offset); // Fields of the instant in the zone
+
+        local.timeZone = periods[i].abbreviation;
+        Parser::RenderFormat(program, local, output);
+        output += '\n';
+    }
+}
@@ -23,250 +23,464 @@
  *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
  */
 
-#include <cstdlib>
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
 #include <ctime>
-#include <iomanip>
-#include <iostream>
-#include <memory>
-#include <sstream>
 #include <string>
+#include <string_view>
 
-#include "day.hpp"
-#include "month.hpp"
+#include "calendar.hpp"
+#include "format.hpp"
 #include "parser.hpp"
+#include "timeOperand.hpp"
+#include "timeZone.hpp"
 
-using std::cout;
-using std::make_unique;
-using std::ostringstream;
-using std::setfill;
-using std::setw;
-using std::stoi;
+using std::int64_t;
 using std::string;
-using std::to_string;
-using std::unique_ptr;
+using std::string_view;
 
-Parser::Parser() = default;
+namespace
+{
+// Converts a local time of a zone to an instant
+auto LocalToInstant(const TimeOperand& fields, const TimeZone& zone) -> time_t
+{
+    return static_cast<time_t>(zone.fromLocal(secondsFromCivil(fields.year, fields.month, fields.day, fields.hour, fields.minute, fields.second)));
+}
 
-auto Parser::ParseFormat(const string& argument, const ClockInterface& clock) -> string
+// Reads between minimum and maximum digits at a position, moving it past them
+auto ReadNumber(string_view text, size_t& position, size_t minimum, size_t maximum, int& value) -> OperandError
+{
+    size_t count = 0; // Number of digits read
+
+    value = 0;
+
+    while (count < maximum && position < text.size() && static_cast<unsigned>(text[position] - '0') <= 9)
+    {
+        value = value * 10 + (text[position] - '0');
+        position++;
+        count++;
+    }
+
+    if (count >= minimum)
+    {
+        return OperandError::None;
+    }
+
+    return position < text.size() ? OperandError::Digit : OperandError::Length;
+}
+
+// Reads a day or month name at a position, moving it past the name. Full names run to the last letter
+template <typename Find>
+auto ReadName(string_view text, size_t& position, size_t length, Find find, int& value) -> OperandError
+{
+    size_t end = std::min(position + length, text.size()); // End of the name
+
+    // Without a length, the name is every letter that follows
+    while (length == 0 && end < text.size() && static_cast<unsigned char>((text[end] | 0x20) - 'a') < 26)
+    {
+        end++;
+    }
+
+    const auto found = find(text.substr(position, end - position));
+
+    if (!found)
+    {
+        return OperandError::Name;
+    }
+
+    position = end;
+    value    = static_cast<int>(*found);
+
+    return OperandError::None;
+}
+
+// Reads the text of a time step (%R, %T), separated by colons
+auto ReadTime(string_view text, size_t& position, TimeOperand& fields, bool hasSeconds) -> OperandError
+{
+    OperandError error = ReadNumber(text, position, 2, 2, fields.hour);
+
+    if (error == OperandError::None)
+    {
+        error = position < text.size() && text[position] == ':' ? ReadNumber(text, ++position, 2, 2, fields.minute) : OperandError::Literal;
+    }
+
+    if (error == OperandError::None && hasSeconds)
+    {
+        error = position < text.size() && text[position] == ':' ? ReadNumber(text, ++position, 2, 2, fields.second) : OperandError::Literal;
+    }
+
+    return error;
+}
+
+// Walks a format string, handing each character of literal text and each directive to its visitor
+template <typename Literal, typename Directive>
+void WalkFormat(string_view argument, Literal addLiteral, Directive addDirective)
 {
-    string formattedDate; // The output date being constructed
-    string tempDate;      // A temporary string in case it's needed
+    Opcode opcode{}; // Opcode of the directive being walked
 
-    for (int i = 0; i < argument.size(); i++)
+    for (size_t i = 0; i < argument.size(); i++)
     {
-        if (argument.at(i) == '%' && i + 1 < argument.size())
+        if (argument[i] == '%' && i + 1 < argument.size())
         {
-            switch (argument.at(i + 1))
+            switch (argument[i + 1])
             {
             case 'a':
-                formattedDate += getShortDayName(clock.getDayOfTheWeek());
-                i++;
+                opcode = Opcode::ShortDay;
                 break;
             case 'A':
-                formattedDate += getLongDayName(clock.getDayOfTheWeek());
-                i++;
+                opcode = Opcode::LongDay;
                 break;
             case 'b':
-                formattedDate += getShortMonthName(clock.getMonth());
-                i++;
+                opcode = Opcode::ShortMonth;
                 break;
             case 'B':
-                formattedDate += getLongMonthName(clock.getMonth());
-                i++;
+                opcode = Opcode::LongMonth;
                 break;
             case 'd':
-                formattedDate += formatTwoDigits(clock.getDay());
-                i++;
+                opcode = Opcode::Day;
                 break;
             case 'e':
-                formattedDate += to_string(clock.getDay());
-                i++;
+                opcode = Opcode::DayNoPad;
                 break;
             case 'H':
-                formattedDate += formatTwoDigits(clock.getHour());
-                i++;
-                break;
-            case 'I':
-                // TODO() : Hour 12h (01-12)
-                break;
-            case 'j':
-                // TODO() : Day of the year (001-366)
+                opcode = Opcode::Hour;
                 break;
             case 'm':
-                formattedDate += formatTwoDigits(clock.getMonth());
-                i++;
+                opcode = Opcode::Month;
                 break;
             case 'M':
-                formattedDate += formatTwoDigits(clock.getMin());
-                i++;
-                break;
-            case 'p':
-                // TODO() : Handles AM/PM
+                opcode = Opcode::Minute;
                 break;
-            case 'r':
-                // TODO(): 12h format (%I:%M:%S %p)
             case 'R':
-                formattedDate += formatTwoDigits(clock.getHour());
-                formattedDate += ":";
-                formattedDate += formatTwoDigits(clock.getMin());
-                i++;
+                opcode = Opcode::HourMinute;
                 break;
             case 'S':
-                formattedDate += formatTwoDigits(clock.getSec());
-                i++;
+                opcode = Opcode::Second;
                 break;
             case 'T':
-                formattedDate += formatTwoDigits(clock.getHour());
-                formattedDate += ":";
-                formattedDate += formatTwoDigits(clock.getMin());
-                formattedDate += ":";
-                formattedDate += formatTwoDigits(clock.getSec());
-                i++;
-                break;
-            case 'u':
-                // TODO() : Day of the week (1=Monday, 7=Sunday)
-                break;
-            case 'w':
-                // TODO() : Day of the week (0=Sunday, 6=Saturday)
+                opcode = Opcode::Time;
                 break;
             case 'y':
-                tempDate = to_string(clock.getYear());
-                formattedDate += tempDate.substr(tempDate.size() - 2);
-                i++;
+                opcode = Opcode::ShortYear;
                 break;
             case 'Y':
-                formattedDate += to_string(clock.getYear());
-                i++;
-                break;
-            case 'z':
-                // TODO() : UTC offset
+                opcode = Opcode::Year;
                 break;
             case 'Z':
-                formattedDate += clock.getTimeZone();
-                i++;
+                opcode = Opcode::TimeZone;
                 break;
+            case 'N':
+                addDirective(Token{Opcode::Fraction, 0, FRACTION_DIGITS});
+                i++;
+                continue;
             case '%':
-                formattedDate += '%';
+                addLiteral('%');
                 i++;
-                break;
+                continue;
             default:
-                formattedDate += argument.at(i);
-                break;
+                // The fraction of the second can be given a width, e.g. %3N for milliseconds
+                if (argument[i + 1] >= '1' && argument[i + 1] <= '9' && i + 2 < argument.size() && argument[i + 2] == 'N')
+                {
+                    addDirective(Token{Opcode::Fraction, 0, static_cast<size_t>(argument[i + 1] - '0')});
+                    i += 2;
+                    continue;
+                }
+
+                // Unknown directive, including %I, %j, %p, %r, %u, %w and %z which aren't supported: the % is
+                // written and the next character is handled as any other
+                addLiteral('%');
+                continue;
             }
+
+            addDirective(Token{opcode});
+            i++;
         }
-        else if (argument.at(i) != '+')
+        else if (argument[i] != '+')
         {
-            formattedDate += argument.at(i);
+            addLiteral(argument[i]);
         }
     }
+}
 
-    formattedDate += '\n';
+} // namespace
 
-    return formattedDate;
+Parser::Parser() = default;
+
+auto Parser::CompileFormat(string_view argument) -> FormatProgram
+{
+    FormatProgram program; // The program being compiled
+
+    // A format has at most one step per character, and fewer literal characters
+    program.tokens.reserve(argument.size());
+    program.literals.reserve(argument.size());
+
+    // Appends a character to the literal run at the end of the program, starting a new run if needed
+    auto addLiteral = [&program](char character)
+    {
+        if (program.tokens.empty() || program.tokens.back().opcode != Opcode::Literal)
+        {
+            program.tokens.push_back({Opcode::Literal, program.literals.size(), 0});
+        }
+
+        program.literals += character;
+        program.tokens.back().length++;
+        program.maxLength++;
+    };
+
+    // Appends a directive to the program
+    auto addDirective = [&program](const Token& token)
+    {
+        program.tokens.push_back(token);
+        program.maxLength += maxTokenLength(token);
+    };
+
+    WalkFormat(argument, addLiteral, addDirective);
+    program.layout = findLayout(argument);
+
+    return program;
+}
+
+void Parser::ExecuteFormat(const FormatProgram& program, const ClockInterface& clock, string& output)
+{
+    RenderFormat(program, clock, output);
 }
 
-auto Parser::ParseDate(string& argument) -> unique_ptr<timespec>
+auto Parser::ParseFormat(const string& argument, const ClockInterface& clock) -> string
 {
-    string monthStr;
-    string dayStr;
-    string hourStr;
-    string minuteStr;
-    string centuryStr;
-    string yearStr;
-    string secondStr;
-    int month                          = 0;
-    int day                            = 0;
-    int hour                           = 0;
-    int minute                         = 0;
-    int year                           = 0;
-    int second                         = 0;
-    constexpr int MAX_MONTH            = 12;
-    constexpr int MAX_DAY              = 31;
-    constexpr int MAX_HOUR             = 24;
-    constexpr int MAX_MIN              = 60;
-    constexpr int MAX_SEC              = 60;
-    constexpr int BASE_YEAR            = 1900;
-    constexpr int BASE_LENGTH          = 7;
-    constexpr int MAX_LENGTH           = 14;
-    constexpr int MONTH_POS            = 0;
-    constexpr int DAY_POS              = 2;
-    constexpr int HOUR_POS             = 4;
-    constexpr int MIN_POS              = 6;
-    constexpr int YEAR_POS             = 8;
-    constexpr int POINT_POS            = 12;
-    constexpr int SECOND_POS           = 13;
-    tm localtime                       = {};
-    time_t time                        = 0;
-    unique_ptr<timespec> convertedTime = make_unique<timespec>();
-
-    if (argument.size() < BASE_LENGTH)
+    const Layout layout = findLayout(argument); // Common layout the format is, if any
+    const FormatProgram none;                   // Program of the steps, which never refer to its literals here
+    string formattedDate;                       // The output date being constructed
+    size_t maxLength    = 1;                    // Largest length of the output date, its newline included
+
+    // Counts the largest length of a literal character or a directive
+    auto countLiteral = [&maxLength](char /*character*/)
     {
-        cout << "Invalid argument\n";
-        return nullptr;
-    }
+        maxLength++;
+    };
 
-    // Extracts the various sections of the date from the argument (ie. day, month, etc)
-    monthStr += argument.substr(MONTH_POS, 2);
-    dayStr += argument.substr(DAY_POS, 2);
-    hourStr += argument.substr(HOUR_POS, 2);
-    minuteStr += argument.substr(MIN_POS, 2);
+    auto countDirective = [&maxLength](const Token& token)
+    {
+        maxLength += maxTokenLength(token);
+    };
 
-    if (argument.size() > BASE_LENGTH) // If the argument is longer than 7, it means we want to set the year
+    // Writes a literal character or a directive
+    auto writeLiteral = [&formattedDate](char character)
     {
-        yearStr += argument.substr(YEAR_POS, 4);
-    }
+        formattedDate += character;
+    };
+
+    auto writeDirective = [&none, &clock, &formattedDate](const Token& token)
+    {
+        RenderToken(none, token, clock, formattedDate);
+    };
 
-    if (argument.size() > MAX_LENGTH && argument.at(POINT_POS) == '.') // If the argument is longer than 12 and the char at position 12 is '.', it means we want to set the seconds
+    // The format is walked twice instead of being compiled, so that the output date is the only allocation
+    WalkFormat(argument, countLiteral, countDirective);
+    formattedDate.reserve(maxLength);
+
+    if (layout == Layout::Generic || !writeLayout(layout, clock, formattedDate))
     {
-        secondStr += argument.substr(SECOND_POS, 2);
+        WalkFormat(argument, writeLiteral, writeDirective);
     }
 
-    // Converts the strings to integer
-    month  = stoi(monthStr);
-    day    = stoi(dayStr);
-    hour   = stoi(hourStr);
-    minute = stoi(minuteStr);
-    year   = stoi(yearStr);
-    second = stoi(secondStr);
+    formattedDate += '\n';
+
+    return formattedDate;
+}
 
-    if (month > 0 && month <= MAX_MONTH)
+auto Parser::ParseDate(string_view argument, int currentYear, const TimeZone& zone) -> DateResult
+{
+    const TimeOperand operand = parseTimeOperand(argument, currentYear); // Validated fields of the operand
+    DateResult result;                                                   // Instant being computed
+
+    result.error = operand.error;
+
+    if (result.error != OperandError::None)
     {
-        localtime.tm_mon = month - 1;
+        return result;
     }
 
-    if (day > 0 && day <= MAX_DAY)
+    result.time.tv_sec = LocalToInstant(operand, zone);
+
+    return result;
+}
+
+auto Parser::ScanFormat(const FormatProgram& program, string_view text, const TimeZone& zone) -> DateResult
+{
+    DateResult result;       // Instant being computed
+    TimeOperand fields;      // Fields read so far, at their value at the Epoch until then
+    size_t position = 0;     // Position in the text
+    int value       = 0;     // Value of the field being read
+    int nanosecond  = 0;     // Fraction of the second, in nanoseconds
+    bool isUtc      = false; // Indicates that %Z named UTC
+
+    fields.year = 1970; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    for (const Token& token : program.tokens)
     {
-        localtime.tm_mday = day;
+        OperandError error = OperandError::None; // Result of the step
+
+        switch (token.opcode)
+        {
+        case Opcode::Literal:
+            if (text.substr(position, token.length) != string_view(program.literals).substr(token.offset, token.length))
+            {
+                error = OperandError::Literal;
+            }
+
+            position += token.length;
+            break;
+        case Opcode::ShortDay:
+            error = ReadName(text, position, 3, findShortDayName, value);
+            break;
+        case Opcode::LongDay:
+            error = ReadName(text, position, 0, findLongDayName, value);
+            break;
+        case Opcode::ShortMonth:
+            error        = ReadName(text, position, 3, findShortMonthName, value);
+            fields.month = static_cast<unsigned>(value + 1);
+            break;
+        case Opcode::LongMonth:
+            error        = ReadName(text, position, 0, findLongMonthName, value);
+            fields.month = static_cast<unsigned>(value + 1);
+            break;
+        case Opcode::Day:
+            error = ReadNumber(text, position, 2, 2, fields.day);
+            break;
+        case Opcode::DayNoPad:
+            position += position < text.size() && text[position] == ' ' ? 1 : 0;
+            error = ReadNumber(text, position, 1, 2, fields.day);
+            break;
+        case Opcode::Hour:
+            error = ReadNumber(text, position, 2, 2, fields.hour);
+            break;
+        case Opcode::Month:
+            error        = ReadNumber(text, position, 2, 2, value);
+            fields.month = static_cast<unsigned>(value);
+            break;
+        case Opcode::Minute:
+            error = ReadNumber(text, position, 2, 2, fields.minute);
+            break;
+        case Opcode::HourMinute:
+            error = ReadTime(text, position, fields, false);
+            break;
+        case Opcode::Second:
+            error = ReadNumber(text, position, 2, 2, fields.second);
+            break;
+        case Opcode::Time:
+            error = ReadTime(text, position, fields, true);
+            break;
+        case Opcode::ShortYear:
+            error       = ReadNumber(text, position, 2, 2, value);
+            fields.year = value + (value < 69 ? 2000 : 1900); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            break;
+        case Opcode::Year:
+        {
+            const bool isNegative = position < text.size() && text[position] == '-'; // Indicates a year before 0
+
+            position += isNegative ? 1 : 0;
+            error       = ReadNumber(text, position, 1, 4, value);
+            fields.year = isNegative ? -value : value;
+            break;
+        }
+        case Opcode::TimeZone:
+        {
+            const size_t start = position; // Beginning of the abbreviation
+
+            while (position < text.size() && (isalpha(static_cast<unsigned char>(text[position])) != 0 || text[position] == '+' || text[position] == '-' || isdigit(static_cast<unsigned char>(text[position])) != 0))
+            {
+                position++;
+            }
+
+            const string_view abbreviation = text.substr(start, position - start);
+
+            isUtc = abbreviation == "UTC" || abbreviation == "UT" || abbreviation == "GMT" || abbreviation == "Z";
+            error = abbreviation.empty() ? OperandError::Zone : OperandError::None;
+            break;
+        }
+        case Opcode::Fraction:
+            error = ReadNumber(text, position, token.length, token.length, nanosecond);
+
+            // Scaled up to nanoseconds, whatever the number of digits
+            for (size_t digit = token.length; digit < FRACTION_DIGITS; digit++)
+            {
+                nanosecond *= 10;
+            }
+
+            break;
+        }
+
+        if (error != OperandError::None)
+        {
+            result.error = error;
+            return result;
+        }
     }
 
-    if (hour > 0 && hour <= MAX_HOUR)
+    if (position != text.size())
     {
-        localtime.tm_hour = hour;
+        result.error = OperandError::Length;
+        return result;
     }
 
-    if (minute > 0 && minute <= MAX_MIN)
+    result.error = checkOperandFields(fields);
+
+    if (result.error != OperandError::None)
     {
-        localtime.tm_min = minute;
+        return result;
     }
 
-    if (second > 0 && second <= MAX_SEC)
+    result.time.tv_sec  = isUtc ? static_cast<time_t>(secondsFromCivil(fields.year, fields.month, fields.day, fields.hour, fields.minute, fields.second)) : LocalToInstant(fields, zone);
+    result.time.tv_nsec = nanosecond;
+
+    return result;
+}
+
+auto Parser::ScanIso8601(string_view text, const TimeZone& zone) -> DateResult
+{
+    const IsoTimestamp timestamp = parseIso8601(text); // Validated fields of the timestamp
+    DateResult result;                                 // Instant being computed
+
+    result.error = timestamp.fields.error;
+
+    if (result.error != OperandError::None)
     {
-        localtime.tm_sec = second;
+        return result;
     }
 
-    localtime.tm_year = year - BASE_YEAR;
+    const TimeOperand& fields = timestamp.fields;
 
-    time = mktime(&localtime);
+    if (timestamp.hasOffset)
+    {
+        result.time.tv_sec = static_cast<time_t>(secondsFromCivil(fields.year, fields.month, fields.day, fields.hour, fields.minute, fields.second) - timestamp.offset);
+    }
+    else
+    {
+        result.time.tv_sec = LocalToInstant(fields, zone);
+    }
 
-    convertedTime->tv_sec  = time;
-    convertedTime->tv_nsec = 0;
+    result.time.tv_nsec = timestamp.nanosecond;
 
-    return convertedTime;
+    return result;
 }
 
-auto Parser::formatTwoDigits(int value) -> string
+auto Parser::IsIso8601(const FormatProgram& program) -> bool
 {
-    ostringstream oss;
-    oss << setw(2) << setfill('0') << value;
-    return oss.str();
+    const auto& tokens = program.tokens; // Steps of the format
+
+    // Checks that a step is a literal run of the given text
+    auto isLiteral = [&program](const Token& token, string_view text)
+    {
+        return token.opcode == Opcode::Literal && string_view(program.literals).substr(token.offset, token.length) == text;
+    };
+
+    if (tokens.size() != 7 && tokens.size() != 9) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        return false;
+    }
+
+    return tokens[0].opcode == Opcode::Year && isLiteral(tokens[1], "-") && tokens[2].opcode == Opcode::Month && isLiteral(tokens[3], "-")
+           && tokens[4].opcode == Opcode::Day && (isLiteral(tokens[5], "T") || isLiteral(tokens[5], " ")) && tokens[6].opcode == Opcode::Time
+           && (tokens.size() == 7 || (isLiteral(tokens[7], ".") && tokens[8].opcode == Opcode::Fraction));
 }
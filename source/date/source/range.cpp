@@ -0,0 +1,258 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <string_view>
+
+#include "calendar.hpp"
+#include "incrementalFormat.hpp"
+#include "parser.hpp"
+#include "range.hpp"
+#include "snapshot.hpp"
+#include "timeOperand.hpp"
+#include "timeZone.hpp"
+#include "writer.hpp"
+
+using std::int64_t;
+using std::string;
+using std::string_view;
+
+namespace
+{
+// Reads the start or the end of a range, a date alone meaning midnight
+auto ReadBound(string_view text, const TimeZone& zone, timespec& bound) -> bool
+{
+    constexpr size_t DATE_LENGTH = 10; // Length of YYYY-MM-DD
+
+    const DateResult date = text.size() == DATE_LENGTH ? Parser::ScanIso8601(string(text) + "T00:00:00", zone) : Parser::ScanIso8601(text, zone);
+
+    bound = date.time;
+
+    return date.error == OperandError::None;
+}
+} // namespace
+
+auto Range::ParseStep(string_view text) -> RangeStep
+{
+    constexpr int64_t MAX_VALUE = 1000000000000; // Largest number of units, which keeps hours in seconds far from overflowing
+
+    RangeStep step;    // Step being parsed
+    int64_t value = 0; // Number of units
+    size_t i      = 0; // Position in the text
+
+    for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++)
+    {
+        value = value * 10 + (text[i] - '0');
+
+        if (value > MAX_VALUE)
+        {
+            return {};
+        }
+    }
+
+    if (i == 0 || value == 0 || text.size() - i > 1)
+    {
+        return {};
+    }
+
+    switch (i < text.size() ? text[i] : 's')
+    {
+    case 's':
+        step.seconds = value;
+        break;
+    case 'm':
+        step.seconds = value * 60;
+        break;
+    case 'h':
+        step.seconds = value * 3600;
+        break;
+    case 'd':
+        step.days = static_cast<int>(std::min<int64_t>(value, 366 * 1000000));
+        break;
+    case 'w':
+        step.days = static_cast<int>(std::min<int64_t>(value, 53 * 1000000) * 7);
+        break;
+    case 'M':
+        step.months = static_cast<int>(std::min<int64_t>(value, 12 * 1000000));
+        break;
+    case 'y':
+        step.months = static_cast<int>(std::min<int64_t>(value, 1000000) * 12);
+        break;
+    default:
+        return {};
+    }
+
+    return step;
+}
+
+auto Range::Parse(string_view text, const TimeZone& zone) -> DateRange
+{
+    DateRange range;                      // Range being parsed
+    const size_t first = text.find('/');  // End of the start
+    const size_t last  = text.rfind('/'); // Beginning of the step
+
+    if (first == string_view::npos || first == last)
+    {
+        return range;
+    }
+
+    range.step    = ParseStep(text.substr(last + 1));
+    range.isValid = (range.step.seconds != 0 || range.step.days != 0 || range.step.months != 0) && ReadBound(text.substr(0, first), zone, range.start)
+                    && ReadBound(text.substr(first + 1, last - first - 1), zone, range.end);
+
+    return range;
+}
+
+auto Range::Generate(int output, const FormatProgram& program, const TimeZone& zone, const DateRange& range) -> bool
+{
+    IncrementalFormat format(program);    // Rendered text, kept from one instant to the next
+    string lines;                         // Lines waiting to be written
+    ZonePeriod period;                    // Period of the zone holding the current instant
+    const int64_t end = range.end.tv_sec; // Last second the range may reach
+
+    lines.reserve(2 * BLOCK_SIZE);
+
+    // Appends the line of an instant, writing the lines once they fill a block
+    auto addLine = [&format, &lines, output](const Snapshot& fields)
+    {
+        lines += format.update(fields);
+        lines += '\n';
+
+        if (lines.size() < BLOCK_SIZE)
+        {
+            return true;
+        }
+
+        const bool isWritten = Writer::Write(output, lines);
+
+        lines.clear();
+
+        return isWritten;
+    };
+
+    if (range.step.days == 0 && range.step.months == 0)
+    {
+        Snapshot utc = breakDown(range.start.tv_sec); // Fields of the current instant in UTC, moved by each step
+
+        utc.nanosecond = static_cast<int>(range.start.tv_nsec);
+
+        for (int64_t instant = range.start.tv_sec; instant <= end; instant += range.step.seconds)
+        {
+            if (!period.contains(instant))
+            {
+                period = zone.find(instant);
+            }
+
+            Snapshot local = shiftBreakDown(utc, period.offset); // Fields of the current instant in the zone
+
+            local.timeZone = period.abbreviation;
+
+            if (!addLine(local))
+            {
+                return false;
+            }
+
+            // The next instant would go past the end, or past the largest instant
+            if (instant > end - range.step.seconds)
+            {
+                break;
+            }
+
+            utc = shiftBreakDown(utc, range.step.seconds);
+        }
+    }
+    else
+    {
+        Snapshot first       = shiftBreakDown(breakDown(range.start.tv_sec), zone.find(range.start.tv_sec).offset); // Local fields of the start
+        const int64_t months = first.year * int64_t{12} + first.month;                                              // Months of the start since year 0
+        const int64_t start  = daysFromCivil(first.year, static_cast<unsigned>(first.month) + 1, first.day);         // Days of the start since the Epoch
+
+        first.nanosecond = static_cast<int>(range.start.tv_nsec);
+
+        for (int64_t step = 0;; step++)
+        {
+            Snapshot local = first; // Local fields of the current instant
+            int64_t days   = 0;     // Days of the current instant since the Epoch
+
+            if (range.step.months != 0)
+            {
+                const int64_t month = months + step * range.step.months; // Months of the current instant since year 0
+
+                local.year  = static_cast<int>(month >= 0 ? month / 12 : (month - 11) / 12);
+                local.month = static_cast<int>(month - local.year * int64_t{12});
+                local.day   = std::min(first.day, static_cast<int>(daysInMonth(local.year, static_cast<unsigned>(local.month) + 1)));
+                days        = daysFromCivil(local.year, static_cast<unsigned>(local.month) + 1, local.day);
+            }
+            else
+            {
+                days = start + step * range.step.days;
+
+                const CivilDate date = civilFromDays(days);
+
+                local.year  = static_cast<int>(date.year);
+                local.month = static_cast<int>(date.month) - 1;
+                local.day   = static_cast<int>(date.day);
+            }
+
+            const int64_t seconds = days * SECONDS_PER_DAY + local.hour * int64_t{3600} + local.minute * int64_t{60} + local.second; // Local time, in seconds
+
+            // The start is printed as given, which may be the second occurrence of a repeated local time; the
+            // next steps are at least a day later, so the first occurrence of their local time is never before it
+            const int64_t instant = step == 0 ? range.start.tv_sec : zone.fromLocal(seconds);
+
+            if (instant > end)
+            {
+                break;
+            }
+
+            if (!period.contains(instant))
+            {
+                period = zone.find(instant);
+            }
+
+            local.dayOfTheWeek = static_cast<int>(weekdayFromDays(days));
+
+            // A local time skipped by a change of offset is printed as the instant it was moved to
+            if (instant + period.offset != seconds)
+            {
+                local            = shiftBreakDown(breakDown(instant), period.offset);
+                local.nanosecond = first.nanosecond;
+            }
+
+            local.timeZone = period.abbreviation;
+
+            if (!addLine(local))
+            {
+                return false;
+            }
+        }
+    }
+
+    return Writer::Write(output, lines);
+}
@@ -0,0 +1,146 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <unistd.h>
+
+#include "clock.hpp"
+#include "incrementalFormat.hpp"
+#include "stamper.hpp"
+#include "timeZone.hpp"
+#include "writer.hpp"
+
+using std::cerr;
+using std::int64_t;
+using std::string;
+using std::string_view;
+using std::vector;
+
+auto Stamper::Resolution(const FormatProgram& program) -> int64_t
+{
+    int64_t resolution = NANOSECONDS_PER_SECOND; // Smallest change shown so far
+
+    for (const Token& token : program.tokens)
+    {
+        if (token.opcode != Opcode::Fraction)
+        {
+            continue;
+        }
+
+        int64_t unit = NANOSECONDS_PER_SECOND; // Value of the last digit of the fraction
+
+        for (size_t digit = 0; digit < token.length; digit++)
+        {
+            unit /= 10;
+        }
+
+        resolution = unit < resolution ? unit : resolution;
+    }
+
+    return resolution;
+}
+
+auto Stamper::PrefixLines(int input, int output, const FormatProgram& prefix, const TimeZone& zone, bool isCoarse) -> bool
+{
+    const int64_t resolution = Resolution(prefix); // Time between two different prefixes
+    vector<char> buffer(BLOCK_SIZE);               // Block read from the input
+    string stamped;                                // Output of the block, waiting to be written
+    IncrementalFormat format(prefix);              // Prefix, kept until the time moves to another unit
+    Clock clock(0, zone);                          // Moved to the time of each block
+    string_view text;                              // The current prefix
+    int64_t unit     = -1;                         // Unit of resolution the prefix was rendered for
+    bool isLineStart = true;                       // Indicates that the next byte begins a line
+
+    stamped.reserve(2 * BLOCK_SIZE);
+
+    while (true)
+    {
+        ssize_t count = read(input, buffer.data(), buffer.size());
+
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            cerr << "Can't read the input: " << strerror(errno) << "\n";
+            return false;
+        }
+
+        if (count == 0)
+        {
+            return true;
+        }
+
+        // Every line of the block arrived at the same time, so the clock is read once
+        const timespec now    = Clock::readTime(isCoarse);
+        const int64_t current = (now.tv_sec * NANOSECONDS_PER_SECOND + now.tv_nsec) / resolution;
+
+        if (current != unit)
+        {
+            const int64_t instant = current * resolution; // The time, truncated to the resolution
+
+            clock.setInstant(timespec{static_cast<time_t>(instant / NANOSECONDS_PER_SECOND), static_cast<long>(instant % NANOSECONDS_PER_SECOND)});
+            text = format.update(clock.getSnapshot());
+            unit = current;
+        }
+
+        const char* position = buffer.data();                               // Beginning of the bytes left to copy
+        const char* end      = buffer.data() + static_cast<size_t>(count); // End of the block
+
+        while (position < end)
+        {
+            if (isLineStart)
+            {
+                stamped.append(text);
+            }
+
+            const auto* newline = static_cast<const char*>(memchr(position, '\n', static_cast<size_t>(end - position)));
+            const char* next    = newline != nullptr ? newline + 1 : end;
+
+            stamped.append(position, next);
+            isLineStart = newline != nullptr;
+            position    = next;
+        }
+
+        // The block is written at once, so that a slow stream isn't held back waiting for more input
+        if (!Writer::Write(output, stamped))
+        {
+            return false;
+        }
+
+        stamped.clear();
+    }
+}
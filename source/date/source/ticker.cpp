@@ -0,0 +1,133 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#include <cerrno>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <string_view>
+
+#include "clock.hpp"
+#include "incrementalFormat.hpp"
+#include "ticker.hpp"
+#include "timeZone.hpp"
+#include "writer.hpp"
+
+using std::int64_t;
+using std::string;
+using std::string_view;
+using std::uint64_t;
+
+auto Ticker::ParseInterval(string_view text) -> int64_t
+{
+    int64_t seconds  = 0;                      // Whole seconds read
+    int64_t fraction = 0;                      // Nanoseconds read after the point
+    int64_t scale    = NANOSECONDS_PER_SECOND; // Value of the next fraction digit, times 10
+    size_t i         = 0;                      // Position in the text
+    size_t digits    = 0;                      // Number of digits read, before and after the point
+
+    // The whole seconds are capped at a year, which keeps the nanoseconds far from overflowing
+    for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++, digits++)
+    {
+        seconds = seconds * 10 + (text[i] - '0');
+
+        if (seconds > 366 * 86400)
+        {
+            return 0;
+        }
+    }
+
+    if (i < text.size() && text[i] == '.')
+    {
+        // Digits past the nanoseconds are ignored
+        for (i++; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++, digits++)
+        {
+            scale /= 10;
+            fraction += (text[i] - '0') * scale;
+        }
+    }
+
+    if (i != text.size() || digits == 0)
+    {
+        return 0;
+    }
+
+    return seconds * NANOSECONDS_PER_SECOND + fraction;
+}
+
+auto Ticker::Run(int output, const FormatProgram& program, const TimeZone& zone, int64_t interval, uint64_t count) -> bool
+{
+    timespec now = Clock::readTime(false);  // Current time, read again after each tick
+    int64_t next = nextTick(now, interval); // Next tick, in nanoseconds since the Epoch
+    IncrementalFormat format(program);      // Rendered text, kept from one tick to the next
+    Clock clock(now, zone);                 // Moved to each tick in turn, keeping the period of the zone
+    string line;                            // Text of a tick, with its newline
+
+    for (uint64_t tick = 0; count == 0 || tick < count; tick++)
+    {
+        const timespec deadline = {static_cast<time_t>(next / NANOSECONDS_PER_SECOND), static_cast<long>(next % NANOSECONDS_PER_SECOND)}; // Time of the tick
+        int error               = 0;                                                                                                      // Result of the sleep
+
+        // The deadline is absolute, so an interrupted sleep is resumed as it is
+        while ((error = clock_nanosleep(CLOCK_REALTIME, TIMER_ABSTIME, &deadline, nullptr)) == EINTR)
+        {
+        }
+
+        if (error != 0)
+        {
+            errno = error;
+            return false;
+        }
+
+        clock.setInstant(deadline);
+
+        const string_view text = format.update(clock.getSnapshot());
+
+        line.assign(text);
+        line += '\n';
+
+        if (!Writer::Write(output, line))
+        {
+            return false;
+        }
+
+        next += interval;
+
+        // Ticks missed while the process couldn't run are skipped
+        now = Clock::readTime(false);
+
+        if (now.tv_sec * NANOSECONDS_PER_SECOND + now.tv_nsec >= next + interval)
+        {
+            next = nextTick(now, interval);
+        }
+    }
+
+    return true;
+}
+
+auto Ticker::nextTick(timespec now, int64_t interval) -> int64_t
+{
+    return ((now.tv_sec * NANOSECONDS_PER_SECOND + now.tv_nsec) / interval + 1) * interval;
+}
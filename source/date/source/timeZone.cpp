@@ -0,0 +1,701 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a full version of the `date` command in C++,
+ *  conforming to the POSIX specification. It displays the current date and time,
+ *  supports timezone adjustments, allows custom output formats, and permits
+ *  setting the system date and time when authorized.
+ *
+ *  Usage: ./date [-u] [+format] [mmddhhmm[[cc]yy][.ss]]
+ *
+ *  Supported options:
+ *    -u      : Display the date and time in "UTC0".
+ *
+ *  Supported features:
+ *    - Display the current date and time in local time or UTC (-u).
+ *    - Custom formatting of output using the +format option.
+ *    - Setting the system date and time (requires appropriate privileges).
+ *    - Handling of the TZ environment variable for timezone settings.
+ *
+ *  Note: More details on the `date` command and its behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/date.html
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "calendar.hpp"
+#include "timeZone.hpp"
+
+using std::array;
+using std::int32_t;
+using std::int64_t;
+using std::numeric_limits;
+using std::string;
+using std::string_view;
+using std::uint32_t;
+using std::uint64_t;
+using std::uint8_t;
+
+namespace
+{
+constexpr int64_t MIN_INSTANT      = numeric_limits<int64_t>::min(); // Beginning of a period without beginning
+constexpr int64_t MAX_INSTANT      = numeric_limits<int64_t>::max(); // End of a period without end
+constexpr size_t HEADER_SIZE       = 44;                             // Size of a TZif header
+constexpr size_t TYPE_SIZE         = 6;                              // Size of a local time type record
+constexpr int32_t SECONDS_PER_HOUR = 3600;                           // Default daylight saving time shift
+constexpr int MAX_RULE_HOURS       = 167;                            // Largest hour of a rule time, as allowed by TZif version 3
+
+// Counts of a TZif header, in file order
+struct Header
+{
+    char version        = 0; // '\0' for version 1, '2', '3', ... for later ones
+    uint32_t isUtCount  = 0; // Number of UT/local indicators
+    uint32_t isStdCount = 0; // Number of standard/wall indicators
+    uint32_t leapCount  = 0; // Number of leap second records
+    uint32_t timeCount  = 0; // Number of transitions
+    uint32_t typeCount  = 0; // Number of local time types
+    uint32_t charCount  = 0; // Size of the abbreviations
+};
+
+// Reads a big-endian 32-bit value
+auto ReadBig32(const char* bytes) -> uint32_t
+{
+    const auto* data = reinterpret_cast<const unsigned char*>(bytes); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    return (uint32_t{data[0]} << 24) | (uint32_t{data[1]} << 16) | (uint32_t{data[2]} << 8) | uint32_t{data[3]};
+}
+
+// Reads a big-endian 64-bit value
+auto ReadBig64(const char* bytes) -> uint64_t
+{
+    return (uint64_t{ReadBig32(bytes)} << 32) | ReadBig32(bytes + 4);
+}
+
+// Reads the header at the beginning of the data, returning false if there is none
+auto ReadHeader(string_view data, Header& header) -> bool
+{
+    if (data.size() < HEADER_SIZE || data.substr(0, 4) != "TZif")
+    {
+        return false;
+    }
+
+    header.version    = data[4];
+    header.isUtCount  = ReadBig32(data.data() + 20);
+    header.isStdCount = ReadBig32(data.data() + 24);
+    header.leapCount  = ReadBig32(data.data() + 28);
+    header.timeCount  = ReadBig32(data.data() + 32);
+    header.typeCount  = ReadBig32(data.data() + 36);
+    header.charCount  = ReadBig32(data.data() + 40);
+
+    return header.typeCount != 0 && header.charCount != 0;
+}
+
+// Returns the size of the data block following a header, for 4 or 8-byte times
+auto DataSize(const Header& header, uint64_t timeSize) -> uint64_t
+{
+    return header.timeCount * (timeSize + 1) + header.typeCount * uint64_t{TYPE_SIZE} + header.charCount +
+           header.leapCount * (timeSize + 4) + header.isStdCount + header.isUtCount;
+}
+
+// Reads an abbreviation, either alphabetic or quoted with angle brackets, at the beginning of a TZ string
+auto ParseName(string_view& text, string& name) -> bool
+{
+    size_t length = 0; // Length of the abbreviation
+
+    if (!text.empty() && text.front() == '<')
+    {
+        size_t close = text.find('>');
+
+        if (close == string_view::npos)
+        {
+            return false;
+        }
+
+        name = string(text.substr(1, close - 1));
+        text.remove_prefix(close + 1);
+    }
+    else
+    {
+        while (length < text.size() && ((text[length] >= 'A' && text[length] <= 'Z') || (text[length] >= 'a' && text[length] <= 'z')))
+        {
+            length++;
+        }
+
+        name = string(text.substr(0, length));
+        text.remove_prefix(length);
+    }
+
+    return name.size() >= 3;
+}
+
+// Reads a number of at most `maxDigits` digits
+auto ParseNumber(string_view& text, int& value, size_t maxDigits) -> bool
+{
+    size_t length = 0; // Number of digits read
+
+    value = 0;
+
+    while (length < maxDigits && length < text.size() && text[length] >= '0' && text[length] <= '9')
+    {
+        value = value * 10 + (text[length] - '0');
+        length++;
+    }
+
+    text.remove_prefix(length);
+
+    return length != 0;
+}
+
+// Reads a signed [+|-]hh[:mm[:ss]] duration, in seconds
+auto ParseDuration(string_view& text, int32_t& seconds) -> bool
+{
+    int sign    = 1; // -1 if the duration is negative
+    int hours   = 0; // Hours read
+    int minutes = 0; // Minutes read, if any
+    int rest    = 0; // Seconds read, if any
+
+    if (!text.empty() && (text.front() == '+' || text.front() == '-'))
+    {
+        sign = text.front() == '-' ? -1 : 1;
+        text.remove_prefix(1);
+    }
+
+    if (!ParseNumber(text, hours, 3) || hours > MAX_RULE_HOURS)
+    {
+        return false;
+    }
+
+    if (!text.empty() && text.front() == ':')
+    {
+        text.remove_prefix(1);
+
+        if (!ParseNumber(text, minutes, 2) || minutes > 59)
+        {
+            return false;
+        }
+
+        if (!text.empty() && text.front() == ':')
+        {
+            text.remove_prefix(1);
+
+            if (!ParseNumber(text, rest, 2) || rest > 59)
+            {
+                return false;
+            }
+        }
+    }
+
+    seconds = sign * ((hours * 60 + minutes) * 60 + rest);
+
+    return true;
+}
+
+// Reads a rule date (Jn, n or Mm.w.d), followed by an optional /time
+auto ParseRuleDate(string_view& text, RuleDate& date) -> bool
+{
+    if (text.empty())
+    {
+        return false;
+    }
+
+    if (text.front() == 'M')
+    {
+        text.remove_prefix(1);
+        date.kind = 'M';
+
+        if (!ParseNumber(text, date.month, 2) || date.month < 1 || date.month > 12 || text.empty() || text.front() != '.')
+        {
+            return false;
+        }
+
+        text.remove_prefix(1);
+
+        if (!ParseNumber(text, date.week, 1) || date.week < 1 || date.week > 5 || text.empty() || text.front() != '.')
+        {
+            return false;
+        }
+
+        text.remove_prefix(1);
+
+        if (!ParseNumber(text, date.day, 1) || date.day > 6)
+        {
+            return false;
+        }
+    }
+    else if (text.front() == 'J')
+    {
+        text.remove_prefix(1);
+        date.kind = 'J';
+
+        if (!ParseNumber(text, date.day, 3) || date.day < 1 || date.day > 365)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        date.kind = 'D';
+
+        if (!ParseNumber(text, date.day, 3) || date.day > 365)
+        {
+            return false;
+        }
+    }
+
+    date.time = 2 * SECONDS_PER_HOUR;
+
+    if (!text.empty() && text.front() == '/')
+    {
+        text.remove_prefix(1);
+        return ParseDuration(text, date.time);
+    }
+
+    return true;
+}
+} // namespace
+
+TimeZone::TimeZone() : types{ZoneType{}}, abbreviations("UTC", 4) {}
+
+auto TimeZone::Utc() -> const TimeZone&
+{
+    static const TimeZone utc; // Default constructed zones are UTC
+
+    return utc;
+}
+
+auto TimeZone::Local() -> const TimeZone&
+{
+    // Loaded once, the first time it is needed, thread-safely
+    static const TimeZone local = []
+    {
+        TimeZone zone;                       // Stays UTC if nothing can be loaded
+        const char* variable = getenv("TZ"); // Zone requested by the user, if any
+
+        if (variable == nullptr)
+        {
+            zone.load("/etc/localtime");
+            return zone;
+        }
+
+        // An invalid TZ means UTC
+        zone.loadName(variable);
+
+        return zone;
+    }();
+
+    return local;
+}
+
+auto TimeZone::loadName(string_view value) -> bool
+{
+    const char* directory = getenv("TZDIR"); // Where zone names are looked up
+    string_view name      = value;           // Zone file, absolute or relative to the zoneinfo directory
+
+    if (!name.empty() && name.front() == ':')
+    {
+        name.remove_prefix(1);
+    }
+
+    // An empty value means UTC
+    if (name.empty())
+    {
+        *this = TimeZone();
+        return true;
+    }
+
+    if (name.front() == '/')
+    {
+        return load(string(name));
+    }
+
+    return load(string(directory != nullptr ? directory : "/usr/share/zoneinfo") + "/" + string(name)) || loadRule(value);
+}
+
+auto TimeZone::load(const string& path) -> bool
+{
+    struct stat status = {};                                   // Size and kind of the file
+    int descriptor     = open(path.c_str(), O_RDONLY | O_CLOEXEC); // File being mapped
+
+    if (descriptor < 0)
+    {
+        return false;
+    }
+
+    if (fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode) || status.st_size < static_cast<off_t>(HEADER_SIZE))
+    {
+        close(descriptor);
+        return false;
+    }
+
+    auto size     = static_cast<size_t>(status.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+    close(descriptor);
+
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+
+    TimeZone parsed; // Only replaces this zone if the whole file is valid
+    bool isValid = parsed.parseData(string_view(static_cast<const char*>(mapping), size));
+
+    munmap(mapping, size);
+
+    if (isValid)
+    {
+        *this = std::move(parsed);
+    }
+
+    return isValid;
+}
+
+auto TimeZone::loadRule(string_view rule) -> bool
+{
+    TimeZone parsed; // Only replaces this zone if the whole rule is valid
+
+    parsed.abbreviations.clear();
+
+    if (!parsed.parseRule(rule))
+    {
+        return false;
+    }
+
+    parsed.types = {parsed.ruleStandard};
+
+    if (parsed.ruleHasDst)
+    {
+        parsed.types.push_back(parsed.ruleDaylight);
+    }
+
+    *this = std::move(parsed);
+
+    return true;
+}
+
+auto TimeZone::parseData(string_view data) -> bool
+{
+    Header header;                   // Counts of the block being read
+    uint64_t timeSize = 4;           // Size of a transition time in the block being read
+    uint64_t position = HEADER_SIZE; // Position of the data block in the file
+
+    if (!ReadHeader(data, header))
+    {
+        return false;
+    }
+
+    // Version 2 and later files repeat the data with 64-bit times, followed by a POSIX TZ string
+    if (header.version >= '2')
+    {
+        uint64_t second = HEADER_SIZE + DataSize(header, timeSize); // Position of the second header
+
+        if (second > data.size() || !ReadHeader(data.substr(second), header))
+        {
+            return false;
+        }
+
+        timeSize = 8;
+        position = second + HEADER_SIZE;
+    }
+
+    if (position + DataSize(header, timeSize) > data.size())
+    {
+        return false;
+    }
+
+    const char* cursor = data.data() + position; // Next byte to read
+
+    transitions.resize(header.timeCount);
+    transitionTypes.resize(header.timeCount);
+    types.resize(header.typeCount);
+
+    for (int64_t& transition : transitions)
+    {
+        transition = timeSize == 8 ? static_cast<int64_t>(ReadBig64(cursor)) : static_cast<int32_t>(ReadBig32(cursor));
+        cursor += timeSize;
+    }
+
+    for (uint8_t& type : transitionTypes)
+    {
+        type = static_cast<uint8_t>(*cursor++);
+
+        if (type >= header.typeCount)
+        {
+            return false;
+        }
+    }
+
+    for (ZoneType& type : types)
+    {
+        type.offset    = static_cast<int32_t>(ReadBig32(cursor));
+        type.isDst     = cursor[4] != 0;
+        type.nameIndex = static_cast<uint8_t>(cursor[5]);
+        cursor += TYPE_SIZE;
+
+        if (type.nameIndex >= header.charCount)
+        {
+            return false;
+        }
+    }
+
+    // Every abbreviation ends with a null character, the last one included
+    abbreviations.assign(cursor, header.charCount);
+    abbreviations += '\0';
+
+    if (!std::is_sorted(transitions.begin(), transitions.end()))
+    {
+        return false;
+    }
+
+    // The POSIX TZ string describes the local time after the last transition, an empty one meaning there is none
+    if (header.version >= '2')
+    {
+        string_view footer = data.substr(position + DataSize(header, timeSize));
+
+        if (footer.size() >= 2 && footer.front() == '\n')
+        {
+            footer.remove_prefix(1);
+            footer = footer.substr(0, footer.find('\n'));
+
+            if (!footer.empty() && !parseRule(footer))
+            {
+                hasRule = false;
+            }
+        }
+    }
+
+    return true;
+}
+
+auto TimeZone::parseRule(string_view rule) -> bool
+{
+    string standardName; // Abbreviation of standard time
+    string daylightName; // Abbreviation of daylight saving time
+    int32_t value = 0;   // Offset read, in seconds west of Greenwich as written in TZ strings
+
+    if (!ParseName(rule, standardName) || !ParseDuration(rule, value))
+    {
+        return false;
+    }
+
+    ruleStandard = {-value, false, static_cast<uint32_t>(abbreviations.size())};
+    ruleHasDst   = !rule.empty();
+
+    if (ruleHasDst)
+    {
+        if (!ParseName(rule, daylightName))
+        {
+            return false;
+        }
+
+        // Daylight saving time is an hour ahead of standard time unless told otherwise
+        value = -ruleStandard.offset - SECONDS_PER_HOUR;
+
+        if (!rule.empty() && rule.front() != ',' && !ParseDuration(rule, value))
+        {
+            return false;
+        }
+
+        ruleDaylight = {-value, true, static_cast<uint32_t>(abbreviations.size() + standardName.size() + 1)};
+
+        if (rule.empty())
+        {
+            rule = ",M3.2.0,M11.1.0";
+        }
+
+        if (rule.front() != ',')
+        {
+            return false;
+        }
+
+        rule.remove_prefix(1);
+
+        if (!ParseRuleDate(rule, ruleStart) || rule.empty() || rule.front() != ',')
+        {
+            return false;
+        }
+
+        rule.remove_prefix(1);
+
+        if (!ParseRuleDate(rule, ruleEnd))
+        {
+            return false;
+        }
+    }
+
+    if (!rule.empty())
+    {
+        return false;
+    }
+
+    abbreviations += standardName;
+    abbreviations += '\0';
+
+    if (ruleHasDst)
+    {
+        abbreviations += daylightName;
+        abbreviations += '\0';
+    }
+
+    hasRule = true;
+
+    return true;
+}
+
+auto TimeZone::find(int64_t instant) const -> ZonePeriod
+{
+    auto next  = std::upper_bound(transitions.begin(), transitions.end(), instant); // First transition after the instant
+    auto index = static_cast<size_t>(next - transitions.begin());                  // Number of transitions up to the instant
+
+    if (index == 0)
+    {
+        if (transitions.empty() && hasRule)
+        {
+            return findWithRule(instant, MIN_INSTANT);
+        }
+
+        return makePeriod(MIN_INSTANT, transitions.empty() ? MAX_INSTANT : transitions.front(), types.front());
+    }
+
+    if (index == transitions.size())
+    {
+        if (hasRule)
+        {
+            return findWithRule(instant, transitions.back());
+        }
+
+        return makePeriod(transitions.back(), MAX_INSTANT, types[transitionTypes.back()]);
+    }
+
+    return makePeriod(transitions[index - 1], transitions[index], types[transitionTypes[index - 1]]);
+}
+
+auto TimeZone::makePeriod(int64_t begin, int64_t end, const ZoneType& type) const -> ZonePeriod
+{
+    ZonePeriod period; // Period being built
+
+    period.begin        = begin;
+    period.end          = end;
+    period.offset       = type.offset;
+    period.isDst        = type.isDst;
+    period.abbreviation = string_view(abbreviations.c_str() + type.nameIndex);
+
+    return period;
+}
+
+auto TimeZone::fromLocal(int64_t localSeconds) const -> int64_t
+{
+    const ZonePeriod guess = find(localSeconds - find(localSeconds).offset); // Period near the instant, off by at most a change
+    const int64_t instant  = localSeconds - guess.offset;                    // Instant if the guess holds it
+
+    // Offsets differ by less than a day, so a day away from the ends of the period the guess is the only one
+    if (guess.begin <= instant - SECONDS_PER_DAY && instant + SECONDS_PER_DAY < guess.end)
+    {
+        return instant;
+    }
+
+    const array<ZonePeriod, 3> periods = {guess.begin != MIN_INSTANT ? find(guess.begin - 1) : guess, guess,
+                                          guess.end != MAX_INSTANT ? find(guess.end) : guess}; // The guess and the periods around it
+
+    // A local time repeated by a change backward is taken in the earliest period holding it
+    for (const ZonePeriod& period : periods)
+    {
+        if (period.contains(localSeconds - period.offset))
+        {
+            return localSeconds - period.offset;
+        }
+    }
+
+    // A local time skipped by a change forward is read with the offset in effect before the change
+    for (size_t i = 0; i + 1 < periods.size(); i++)
+    {
+        if (periods[i].end == periods[i + 1].begin && localSeconds - periods[i].offset >= periods[i].end
+            && localSeconds - periods[i + 1].offset < periods[i + 1].begin)
+        {
+            return localSeconds - periods[i].offset;
+        }
+    }
+
+    return instant;
+}
+
+auto TimeZone::findWithRule(int64_t instant, int64_t notBefore) const -> ZonePeriod
+{
+    if (!ruleHasDst)
+    {
+        return makePeriod(notBefore, MAX_INSTANT, ruleStandard);
+    }
+
+    array<std::pair<int64_t, bool>, 6> changes = {};                                 // Changes of the years around the instant, true when daylight saving time starts
+    const int64_t year                         = breakDown(instant + ruleStandard.offset).year; // Year of the instant, in standard time
+    size_t count                               = 0;                                           // Number of changes computed
+
+    for (int64_t changeYear = year - 1; changeYear <= year + 1; changeYear++)
+    {
+        changes.at(count++) = {ruleInstant(ruleStart, changeYear, ruleStandard.offset), true};
+        changes.at(count++) = {ruleInstant(ruleEnd, changeYear, ruleDaylight.offset), false};
+    }
+
+    std::sort(changes.begin(), changes.end());
+
+    // The instant is always after the first change, as it belongs to the year before
+    size_t index = 0; // Last change up to the instant
+
+    while (index + 1 < changes.size() && changes.at(index + 1).first <= instant)
+    {
+        index++;
+    }
+
+    return makePeriod(std::max(changes.at(index).first, notBefore), index + 1 < changes.size() ? changes.at(index + 1).first : MAX_INSTANT,
+                      changes.at(index).second ? ruleDaylight : ruleStandard);
+}
+
+auto TimeZone::ruleInstant(const RuleDate& date, int64_t year, int32_t offset) -> int64_t
+{
+    int64_t day = daysFromCivil(year, 1, 1); // Day of the change, since the Epoch
+
+    switch (date.kind)
+    {
+    case 'J':
+        // February 29th is never counted, even in leap years
+        day += date.day - 1 + (date.day >= 60 && isLeapYear(year) ? 1 : 0);
+        break;
+    case 'D':
+        day += date.day;
+        break;
+    default:
+    {
+        const auto month    = static_cast<unsigned>(date.month);                                             // Month of the change
+        const int64_t first = daysFromCivil(year, month, 1);                                                 // First day of the month
+        const int64_t next  = month == 12 ? daysFromCivil(year + 1, 1, 1) : daysFromCivil(year, month + 1, 1); // First day of the next month
+        const auto weekday  = static_cast<int>(weekdayFromDays(first));                                      // Day of the week of the first day
+
+        day = first + (date.day - weekday + 7) % 7 + (date.week - 1) * 7;
+
+        // The fifth week means the last one, which may be the fourth
+        while (day >= next)
+        {
+            day -= 7;
+        }
+
+        break;
+    }
+    }
+
+    return day * SECONDS_PER_DAY + date.time - offset;
+}
@@ -0,0 +1,611 @@
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include "clock.hpp"
+#include "digits.hpp"
+#include "incrementalFormat.hpp"
+#include "layout.hpp"
+#include "month.hpp"
+#include "multiZone.hpp"
+#include "parser.hpp"
+#include "range.hpp"
+#include "stamper.hpp"
+#include "timeOperand.hpp"
+#include "timeZone.hpp"
+
+using std::array;
+using std::int64_t;
+using std::ostringstream;
+using std::setfill;
+using std::setw;
+using std::string;
+using std::string_view;
+
+namespace
+{
+// Time zone lookup the first time it happens in the process, mapping and reading the zone file.
+// Registered first and run once, as the zone stays loaded afterwards
+void BM_FirstZoneLookup(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Clock(false).getTimeZone());
+    }
+}
+
+void BM_ClockLocal(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Clock(false));
+    }
+}
+
+void BM_ClockLocalWithZone(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Clock(false).getTimeZone());
+    }
+}
+
+void BM_ClockUtc(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Clock(true));
+    }
+}
+
+// What `date +%s`-style invocations pay: a clock and a format without %Z
+void BM_FormatWithoutZone(benchmark::State& state)
+{
+    string format = "+%Y%m%d%H%M%S";
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Parser::ParseFormat(format, Clock(false)));
+    }
+}
+
+// The default format of date, which needs the time zone abbreviation
+void BM_FormatWithZone(benchmark::State& state)
+{
+    string format = "+%a %b %e %H:%M:%S %Z %Y";
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Parser::ParseFormat(format, Clock(false)));
+    }
+}
+
+// A format of a single directive
+void BM_ParseFormatShort(benchmark::State& state)
+{
+    string format = "+%H";
+    Clock clock(true);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Parser::ParseFormat(format, clock));
+    }
+}
+
+// A format using every directive, with text in between
+void BM_ParseFormatLong(benchmark::State& state)
+{
+    string format = "+Today is %A (%a) %d %B (%b, %m) %Y (%y), day %e, at %H:%M:%S (%R, %T) and %N ns %Z, 100%%";
+    Clock clock(true);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Parser::ParseFormat(format, clock));
+    }
+}
+
+// A 4 KiB format of unknown directives, escaped percents and stray plus signs, reported in bytes per second
+void BM_ParseFormatPathological(benchmark::State& state)
+{
+    string format;
+    Clock clock(true);
+
+    while (format.size() < 4096) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        format += "%q%%+%I%";
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Parser::ParseFormat(format, clock));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * format.size()));
+}
+
+// Two-digit field formatted the way Parser::formatTwoDigits used to, as a reference
+void BM_TwoDigitsStream(benchmark::State& state)
+{
+    int value = 0;
+
+    for (auto _ : state)
+    {
+        ostringstream oss;
+        oss << setw(2) << setfill('0') << value;
+        benchmark::DoNotOptimize(oss.str());
+        value = (value + 1) % 60; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    }
+}
+
+// Two-digit field copied from the digit pair table
+void BM_TwoDigitsTable(benchmark::State& state)
+{
+    array<char, 2> digits = {};
+    unsigned value        = 0;
+
+    for (auto _ : state)
+    {
+        writeTwoDigits(digits.data(), value);
+        benchmark::DoNotOptimize(digits);
+        value = (value + 1) % 60; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    }
+}
+
+// Nine-digit zero-padded field, as for nanoseconds
+void BM_NineDigitsTable(benchmark::State& state)
+{
+    array<char, 9> digits = {};
+    unsigned value        = 0;
+
+    for (auto _ : state)
+    {
+        writeDigits(digits.data(), value, digits.size());
+        benchmark::DoNotOptimize(digits);
+        value = (value + 7919) % 1000000000; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    }
+}
+
+// Five two-digit fields through the compiled format, reported per field
+void BM_ExecuteTwoDigitFields(benchmark::State& state)
+{
+    FormatProgram program = Parser::CompileFormat("+%d%H%M%S%m");
+    Clock clock(true);
+    string output;
+
+    for (auto _ : state)
+    {
+        output.clear();
+        Parser::ExecuteFormat(program, clock, output);
+        benchmark::DoNotOptimize(output);
+    }
+
+    state.counters["fields"] = benchmark::Counter(static_cast<double>(state.iterations() * 5), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+// The default format, every field read through the virtual accessors of the clock
+void BM_ExecuteVirtual(benchmark::State& state)
+{
+    FormatProgram program = Parser::CompileFormat("+%a %b %e %H:%M:%S %Z %Y");
+    Clock clock(true);
+    string output;
+
+    for (auto _ : state)
+    {
+        output.clear();
+        Parser::ExecuteFormat(program, clock, output);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+// The default format, every field read inline from a snapshot taken once per instant
+void BM_RenderSnapshot(benchmark::State& state)
+{
+    FormatProgram program = Parser::CompileFormat("+%a %b %e %H:%M:%S %Z %Y");
+    Clock clock(true);
+    string output;
+
+    for (auto _ : state)
+    {
+        output.clear();
+        Parser::RenderFormat(program, clock.getSnapshot(), output);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+// Binary search of the local zone's transitions, at instants spread over a century
+void BM_ZoneFind(benchmark::State& state)
+{
+    const TimeZone& zone = TimeZone::Local();
+    int64_t instant      = 0;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(zone.find(instant));
+        instant = (instant + 7919 * 3607) % 3155760000; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    }
+}
+
+// A clock moved forward a minute at a time in local time, as a batch of sorted instants would
+void BM_ClockLocalSequential(benchmark::State& state)
+{
+    Clock clock(0, false);
+    time_t instant = 1700000000; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    for (auto _ : state)
+    {
+        clock.setInstant(instant);
+        benchmark::DoNotOptimize(clock.getSnapshot());
+        instant += 60; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    }
+}
+
+// Validation of date operands of every form, valid or not, reported in bytes and operands per second
+void BM_ParseTimeOperand(benchmark::State& state)
+{
+    const array<string_view, 8> operands = {"07041230", "0704123025", "070412302025", "070412302025.45",
+                                            "13041230", "02301230", "07041230x5", "0704123"};
+    size_t bytes                         = 0;
+    size_t index                         = 0;
+
+    for (auto _ : state)
+    {
+        const string_view operand = operands.at(index);
+
+        benchmark::DoNotOptimize(parseTimeOperand(operand, 2025)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        bytes += operand.size();
+        index = (index + 1) % operands.size();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Validation and conversion of a date operand to an instant, in local time
+void BM_ParseDate(benchmark::State& state)
+{
+    const TimeZone& zone = TimeZone::Local();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Parser::ParseDate("070412302025.45", 2025, zone)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    }
+}
+
+// Reading the precise real-time clock, as every stamp does by default
+void BM_ReadTimePrecise(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Clock::readTime(false));
+    }
+}
+
+// Reading the coarse real-time clock (-c)
+void BM_ReadTimeCoarse(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Clock::readTime(true));
+    }
+}
+
+// A millisecond stamp of the current time, in UTC
+void BM_FormatMilliseconds(benchmark::State& state)
+{
+    FormatProgram program = Parser::CompileFormat("+%T.%3N");
+    string output;
+
+    for (auto _ : state)
+    {
+        output.clear();
+        Parser::RenderFormat(program, Clock(true).getSnapshot(), output);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+// The default format rendered for consecutive seconds, in full each time
+void BM_TickFullRender(benchmark::State& state)
+{
+    FormatProgram program = Parser::CompileFormat("+%a %b %e %H:%M:%S %Z %Y");
+    Clock clock(0, TimeZone::Local());
+    time_t instant = 1700000000; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    string output;
+
+    for (auto _ : state)
+    {
+        clock.setInstant(instant++);
+        output.clear();
+        Parser::RenderFormat(program, clock.getSnapshot(), output);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+// The default format rendered for consecutive seconds, only the changed fields being rendered again
+void BM_TickIncremental(benchmark::State& state)
+{
+    IncrementalFormat format(Parser::CompileFormat("+%a %b %e %H:%M:%S %Z %Y"));
+    Clock clock(0, TimeZone::Local());
+    time_t instant = 1700000000; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    for (auto _ : state)
+    {
+        clock.setInstant(instant++);
+        benchmark::DoNotOptimize(format.update(clock.getSnapshot()));
+    }
+}
+
+// Log lines of 100 bytes stamped with milliseconds, from a 64 MiB file to /dev/null, reported in bytes per second
+void BM_StampLines(benchmark::State& state)
+{
+    const string line     = string(99, 'x') + "\n"; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    FormatProgram program = Parser::CompileFormat("+%T.%3N ");
+    FILE* input           = tmpfile();
+    FILE* output          = fopen("/dev/null", "w");
+    string block;
+
+    for (size_t i = 0; i < 10000; i++) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        block += line;
+    }
+
+    for (size_t i = 0; i < 67; i++) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        fwrite(block.data(), 1, block.size(), input);
+    }
+
+    fflush(input);
+
+    for (auto _ : state)
+    {
+        lseek(fileno(input), 0, SEEK_SET);
+        benchmark::DoNotOptimize(Stamper::PrefixLines(fileno(input), fileno(output), program, TimeZone::Utc(), false));
+    }
+
+    fclose(input);
+    fclose(output);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * 67 * block.size())); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+// An RFC 3339 timestamp read back by the C library, as a reference
+void BM_ScanStrptime(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        tm fields = {};
+
+        strptime("2025-07-04T12:30:45", "%Y-%m-%dT%H:%M:%S", &fields);
+        benchmark::DoNotOptimize(timegm(&fields));
+    }
+}
+
+// An RFC 3339 timestamp read back through the directives of the format
+void BM_ScanFormat(benchmark::State& state)
+{
+    FormatProgram program = Parser::CompileFormat("+%Y-%m-%dT%T");
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Parser::ScanFormat(program, "2025-07-04T12:30:45", TimeZone::Utc()));
+    }
+}
+
+// An RFC 3339 timestamp read back by the fixed-width fast path
+void BM_ScanIso8601(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Parser::ScanIso8601("2025-07-04T12:30:45Z", TimeZone::Utc()));
+    }
+}
+
+// A common layout (1: default, 2: ISO 8601, 3: RFC 5322) written by its fixed writer, for consecutive seconds
+void BM_RenderLayout(benchmark::State& state)
+{
+    FormatProgram program = Parser::CompileFormat(LAYOUT_FORMATS.at(static_cast<size_t>(state.range(0))));
+    Clock clock(0, TimeZone::Local());
+    time_t instant = 1700000000; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    string output;
+
+    for (auto _ : state)
+    {
+        clock.setInstant(instant++);
+        output.clear();
+        Parser::RenderFormat(program, clock.getSnapshot(), output);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+// The same layouts executed step by step by the interpreter
+void BM_RenderInterpreted(benchmark::State& state)
+{
+    FormatProgram program = Parser::CompileFormat(LAYOUT_FORMATS.at(static_cast<size_t>(state.range(0))));
+    Clock clock(0, TimeZone::Local());
+    time_t instant = 1700000000; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    string output;
+
+    program.layout = Layout::Generic;
+
+    for (auto _ : state)
+    {
+        clock.setInstant(instant++);
+        output.clear();
+        Parser::RenderFormat(program, clock.getSnapshot(), output);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+// The current time in as many zones as the argument, broken down once and moved by each zone's offset
+void BM_MultiZone(benchmark::State& state)
+{
+    const std::array<const char*, 4> rules = {"CET-1CEST,M3.5.0,M10.5.0/3", "EST5EDT", "JST-9", "NZST-12NZDT,M9.5.0,M4.1.0/3"};
+    FormatProgram program                  = Parser::CompileFormat("+%a %b %e %H:%M:%S %Z %Y");
+    MultiZone zones;
+    string output;
+
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        zones.add(rules.at(static_cast<size_t>(i) % rules.size()));
+    }
+
+    for (auto _ : state)
+    {
+        output.clear();
+        zones.render(Clock::readTime(false), program, output);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+// The current time in as many zones as the argument, with a clock per zone as separate runs of date would
+void BM_ClockPerZone(benchmark::State& state)
+{
+    const std::array<const char*, 4> rules = {"CET-1CEST,M3.5.0,M10.5.0/3", "EST5EDT", "JST-9", "NZST-12NZDT,M9.5.0,M4.1.0/3"};
+    FormatProgram program                  = Parser::CompileFormat("+%a %b %e %H:%M:%S %Z %Y");
+    std::vector<TimeZone> zones(static_cast<size_t>(state.range(0)));
+    string output;
+
+    for (size_t i = 0; i < zones.size(); i++)
+    {
+        zones[i].loadName(rules.at(i % rules.size()));
+    }
+
+    for (auto _ : state)
+    {
+        const timespec now = Clock::readTime(false);
+
+        output.clear();
+
+        for (const TimeZone& zone : zones)
+        {
+            Parser::RenderFormat(program, Clock(now, zone).getSnapshot(), output);
+            output += '\n';
+        }
+
+        benchmark::DoNotOptimize(output);
+    }
+}
+// A partition path for every hour of a year in Paris, to /dev/null, reported in lines per second
+void BM_GenerateHourly(benchmark::State& state)
+{
+    TimeZone paris;
+    FormatProgram program = Parser::CompileFormat("+logs/%Y/%m/%d/%H");
+    FILE* output          = fopen("/dev/null", "w");
+
+    paris.loadRule("CET-1CEST,M3.5.0,M10.5.0/3");
+
+    const DateRange range = Range::Parse("2024-01-01/2024-12-31T23:00:00/1h", paris);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Range::Generate(fileno(output), program, paris, range));
+    }
+
+    fclose(output);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 366 * 24)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+// The same paths with a clock per hour, as a loop calling date would render them
+void BM_ClockPerHour(benchmark::State& state)
+{
+    TimeZone paris;
+    FormatProgram program = Parser::CompileFormat("+logs/%Y/%m/%d/%H");
+    string output;
+
+    paris.loadRule("CET-1CEST,M3.5.0,M10.5.0/3");
+
+    const DateRange range = Range::Parse("2024-01-01/2024-12-31T23:00:00/1h", paris);
+
+    for (auto _ : state)
+    {
+        output.clear();
+
+        for (int64_t instant = range.start.tv_sec; instant <= range.end.tv_sec; instant += 3600) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        {
+            Parser::RenderFormat(program, Clock(timespec{static_cast<time_t>(instant), 0}, paris).getSnapshot(), output);
+            output += '\n';
+        }
+
+        benchmark::DoNotOptimize(output);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 366 * 24)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+// Every full month name looked up in its perfect hash table, ignoring case
+void BM_FindMonthHash(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (const std::string_view name : LONG_MONTH_NAMES)
+        {
+            benchmark::DoNotOptimize(findLongMonthName(name));
+        }
+    }
+}
+
+// Every full month name looked up by comparing it to each name in turn, as a reference
+void BM_FindMonthLinear(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (const std::string_view name : LONG_MONTH_NAMES)
+        {
+            int month = 0;
+
+            while (month < 12 && getLongMonthName(month) != name) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            {
+                month++;
+            }
+
+            benchmark::DoNotOptimize(month);
+        }
+    }
+}
+} // namespace
+
+BENCHMARK(BM_FirstZoneLookup)->Iterations(1);
+BENCHMARK(BM_ClockLocal);
+BENCHMARK(BM_ClockLocalWithZone);
+BENCHMARK(BM_ClockUtc);
+BENCHMARK(BM_FormatWithoutZone);
+BENCHMARK(BM_FormatWithZone);
+BENCHMARK(BM_ParseFormatShort);
+BENCHMARK(BM_ParseFormatLong);
+BENCHMARK(BM_ParseFormatPathological);
+BENCHMARK(BM_TwoDigitsStream);
+BENCHMARK(BM_TwoDigitsTable);
+BENCHMARK(BM_NineDigitsTable);
+BENCHMARK(BM_ExecuteTwoDigitFields);
+BENCHMARK(BM_ExecuteVirtual);
+BENCHMARK(BM_RenderSnapshot);
+BENCHMARK(BM_ZoneFind);
+BENCHMARK(BM_ClockLocalSequential);
+BENCHMARK(BM_ParseTimeOperand);
+BENCHMARK(BM_ParseDate);
+BENCHMARK(BM_ReadTimePrecise);
+BENCHMARK(BM_ReadTimeCoarse);
+BENCHMARK(BM_FormatMilliseconds);
+BENCHMARK(BM_TickFullRender);
+BENCHMARK(BM_TickIncremental);
+BENCHMARK(BM_StampLines);
+BENCHMARK(BM_ScanStrptime);
+BENCHMARK(BM_ScanFormat);
+BENCHMARK(BM_ScanIso8601);
+BENCHMARK(BM_RenderLayout)->DenseRange(1, 3);
+BENCHMARK(BM_RenderInterpreted)->DenseRange(1, 3);
+BENCHMARK(BM_MultiZone)->Arg(1)->Arg(4)->Arg(16);
+BENCHMARK(BM_ClockPerZone)->Arg(1)->Arg(4)->Arg(16);
+BENCHMARK(BM_GenerateHourly);
+BENCHMARK(BM_ClockPerHour);
+BENCHMARK(BM_FindMonthHash);
+BENCHMARK(BM_FindMonthLinear);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Path of the date executable, given by CMake; it can also be given on the command line
+#ifndef DATE_BINARY
+#define DATE_BINARY "./date"
+#endif
+
+using std::cerr;
+using std::cout;
+using std::int64_t;
+using std::span;
+using std::string;
+using std::vector;
+
+extern char** environ; // NOLINT(readability-redundant-declaration)
+
+namespace
+{
+constexpr size_t WARMUP_RUNS  = 20;   // Runs made before measuring, so the executable and the zone file are cached
+constexpr size_t DEFAULT_RUNS = 1000; // Runs measured for each command line, unless given
+
+// Latencies of a command line, in nanoseconds, sorted
+struct Latencies
+{
+    vector<int64_t> samples; // One per run, sorted
+    bool isValid = true;     // Cleared if a run couldn't be spawned or failed
+};
+
+auto Now() -> int64_t
+{
+    timespec now = {};
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec * 1000000000 + now.tv_nsec; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+// Runs a command line once, its output going to /dev/null, and returns its latency from spawn to exit
+auto RunOnce(vector<char*>& arguments, const posix_spawn_file_actions_t& actions) -> int64_t
+{
+    pid_t child   = 0;     // The process running date
+    int status    = 0;     // Exit status of the process
+    int64_t start = Now(); // Time of the spawn
+
+    if (posix_spawn(&child, arguments.front(), &actions, nullptr, arguments.data(), environ) != 0)
+    {
+        return -1;
+    }
+
+    while (waitpid(child, &status, 0) < 0)
+    {
+        if (errno != EINTR)
+        {
+            return -1;
+        }
+    }
+
+    const int64_t latency = Now() - start;
+
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? latency : -1;
+}
+
+// Runs a command line many times and collects its latencies
+auto Measure(vector<string> command, size_t runs) -> Latencies
+{
+    Latencies result;                   // Latencies being collected
+    vector<char*> arguments;            // Arguments of the command, ending with a null pointer
+    posix_spawn_file_actions_t actions; // Redirects the output of date to /dev/null
+
+    for (string& argument : command)
+    {
+        arguments.push_back(argument.data());
+    }
+
+    arguments.push_back(nullptr);
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+
+    for (size_t run = 0; run < WARMUP_RUNS + runs && result.isValid; run++)
+    {
+        const int64_t latency = RunOnce(arguments, actions);
+
+        result.isValid = latency >= 0;
+
+        if (run >= WARMUP_RUNS)
+        {
+            result.samples.push_back(latency);
+        }
+    }
+
+    posix_spawn_file_actions_destroy(&actions);
+    std::sort(result.samples.begin(), result.samples.end());
+
+    return result;
+}
+
+// Returns a percentile of sorted latencies, in microseconds, 100 being the maximum
+auto Percentile(const vector<int64_t>& samples, size_t percent) -> double
+{
+    const size_t index = std::min(samples.size() - 1, samples.size() * percent / 100); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    return static_cast<double>(samples.at(index)) / 1000.0; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+// Writes a row of the report, with its columns aligned
+template <typename... Columns>
+void Report(const string& command, const Columns&... columns)
+{
+    constexpr int COMMAND_WIDTH = 56; // Width of the command line column
+    constexpr int COLUMN_WIDTH  = 10; // Width of the other columns
+
+    cout << std::left << std::setw(COMMAND_WIDTH) << command << std::right << std::fixed << std::setprecision(1);
+    ((cout << std::setw(COLUMN_WIDTH) << columns), ...);
+    cout << "\n";
+}
+} // namespace
+
+/**
+ * End-to-end latency of date, from fork/exec to exit, as a shell script pays it.
+ *
+ * Usage: benchStartup [date executable] [runs] [maximum p99 in microseconds]
+ *
+ * Each command line is run a few times to warm the caches, then measured; the minimum, median (p50),
+ * 99th percentile (p99) and maximum are reported in microseconds. With a maximum p99, the harness fails
+ * when a command line goes over it, so that a startup regression can fail a build.
+ */
+auto main(int argc, char* argv[]) -> int
+{
+    span<char*> options(argv + 1, static_cast<size_t>(argc - 1));                                    // Arguments of the harness
+    const string binary = !options.empty() ? options[0] : DATE_BINARY;                               // The executable measured
+    const size_t runs   = options.size() > 1 ? std::strtoul(options[1], nullptr, 10) : DEFAULT_RUNS; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    const double limit  = options.size() > 2 ? std::strtod(options[2], nullptr) : 0;                 // Maximum p99, 0 for none
+    bool isPassing      = true;                                                                      // Cleared if a command line failed or went over the limit
+
+    const std::array<vector<string>, 4> commands = {{
+        {binary},
+        {binary, "-u"},
+        {binary, "+%Y-%m-%dT%T.%3N"},
+        {binary, "+%A %d %B %Y, week day %a, %R:%S %Z"},
+    }};
+
+    if (runs == 0)
+    {
+        cerr << "Invalid number of runs\n";
+        return EXIT_FAILURE;
+    }
+
+    Report("Command", "min (us)", "p50 (us)", "p99 (us)", "max (us)");
+
+    for (const vector<string>& command : commands)
+    {
+        const Latencies latencies = Measure(command, runs);
+        string line;
+
+        for (const string& argument : command)
+        {
+            line += (line.empty() ? "" : " ") + argument;
+        }
+
+        if (!latencies.isValid)
+        {
+            cerr << "Can't run " << line << "\n";
+            isPassing = false;
+            continue;
+        }
+
+        const double p99 = Percentile(latencies.samples, 99); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+        Report(line, Percentile(latencies.samples, 0), Percentile(latencies.samples, 50), p99, Percentile(latencies.samples, 100)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+        if (limit > 0 && p99 > limit)
+        {
+            cerr << line << ": p99 of " << p99 << " us is over the limit of " << limit << " us\n";
+            isPassing = false;
+        }
+    }
+
+    return isPassing ? EXIT_SUCCESS : EXIT_FAILURE;
+}
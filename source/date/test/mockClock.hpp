@@ -17,6 +17,7 @@ public:
     MOCK_METHOD(int, getHour, (), (const, override));
     MOCK_METHOD(int, getMin, (), (const, override));
     MOCK_METHOD(int, getSec, (), (const, override));
+    MOCK_METHOD(int, getNanosecond, (), (const, override));
     MOCK_METHOD(int, getDayOfTheWeek, (), (const, override));
     MOCK_METHOD(std::string, getTimeZone, (), (const, override));
 };
@@ -1,14 +1,74 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <new>
 #include <string>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include <gtest/gtest.h>
 
+#include <unistd.h>
+
+#include "batch.hpp"
+#include "calendar.hpp"
+#include "clock.hpp"
+#include "day.hpp"
+#include "digits.hpp"
+#include "incrementalFormat.hpp"
 #include "mockClock.hpp"
+#include "month.hpp"
+#include "multiZone.hpp"
 #include "parser.hpp"
+#include "range.hpp"
+#include "snapshot.hpp"
+#include "stamper.hpp"
+#include "ticker.hpp"
+#include "timeZone.hpp"
 
+using std::int64_t;
 using std::string;
 using testing::Return;
 
+namespace
+{
+std::atomic<size_t> allocations = 0; // Number of allocations made by the test executable so far
+} // namespace
+
+// Counts every allocation, so that tests can check how many a call makes
+auto operator new(size_t size) -> void*
+{
+    allocations++;
+
+    if (void* memory = std::malloc(size)) // NOLINT(cppcoreguidelines-no-malloc)
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+// GCC sees the replaced operator new once inlined, and mistakes the free() calls for a mismatch
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory); // NOLINT(cppcoreguidelines-no-malloc, cppcoreguidelines-owning-memory)
+}
+
+void operator delete(void* memory, size_t /*size*/) noexcept
+{
+    std::free(memory); // NOLINT(cppcoreguidelines-no-malloc, cppcoreguidelines-owning-memory)
+}
+
+#pragma GCC diagnostic pop
+
 TEST(ParserFormatTests, DoublePercent)
 {
     MockClock clock;
@@ -26,7 +86,7 @@ TEST(ParserFormatTests, FormatsShortNumericDate)
     ON_CALL(clock, getMonth()).WillByDefault(Return(2)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
     ON_CALL(clock, getYear()).WillByDefault(Return(99)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
 
-    EXPECT_EQ(Parser::ParseFormat(format, clock), "02/02/99\n");
+    EXPECT_EQ(Parser::ParseFormat(format, clock), "02/03/99\n");
 }
 
 TEST(ParserFormatTests, LongTimePlaceholder)
@@ -133,4 +193,949 @@ TEST(ParserFormatTests, UnknownPlaceholder)
     string format = "Date: %x";
 
     EXPECT_EQ(Parser::ParseFormat(format, clock), "Date: %x\n");
-}
\ No newline at end of file
+}
+
+TEST(ParserFormatTests, UnsupportedPlaceholders)
+{
+    MockClock clock;
+    string format = "%I %j %p %r %u %w %z";
+
+    EXPECT_EQ(Parser::ParseFormat(format, clock), "%I %j %p %r %u %w %z\n");
+}
+
+TEST(ParserFormatTests, CompiledFormatLayout)
+{
+    FormatProgram program = Parser::CompileFormat("+Now: %H:%M %x%%");
+
+    ASSERT_EQ(program.tokens.size(), 5);
+    EXPECT_EQ(program.tokens.at(0).opcode, Opcode::Literal);
+    EXPECT_EQ(program.literals.substr(program.tokens.at(0).offset, program.tokens.at(0).length), "Now: ");
+    EXPECT_EQ(program.tokens.at(1).opcode, Opcode::Hour);
+    EXPECT_EQ(program.tokens.at(2).opcode, Opcode::Literal);
+    EXPECT_EQ(program.tokens.at(3).opcode, Opcode::Minute);
+    EXPECT_EQ(program.literals.substr(program.tokens.at(4).offset, program.tokens.at(4).length), " %x%");
+}
+
+TEST(ParserFormatTests, RecognizesLayouts)
+{
+    EXPECT_EQ(Parser::CompileFormat("+%a %b %e %H:%M:%S %Z %Y").layout, Layout::Default);
+    EXPECT_EQ(Parser::CompileFormat("%Y-%m-%dT%T").layout, Layout::Iso8601);
+    EXPECT_EQ(Parser::CompileFormat("+%a, %d %b %Y %T %Z").layout, Layout::Rfc5322);
+    EXPECT_EQ(Parser::CompileFormat("+%Y-%m-%dT%T ").layout, Layout::Generic);
+    EXPECT_EQ(Parser::CompileFormat("+%H:%M").layout, Layout::Generic);
+    EXPECT_EQ(Parser::CompileFormat("").layout, Layout::Generic);
+}
+
+TEST(ParserFormatTests, LayoutsMatchInterpreter)
+{
+    const std::array<const char*, 3> formats = {"+%a %b %e %H:%M:%S %Z %Y", "+%Y-%m-%dT%T", "+%a, %d %b %Y %T %Z"};
+    const std::array<const char*, 3> rules   = {"CET-1CEST,M3.5.0,M10.5.0/3", "<+0330>-3:30", "<ABCDEFGHIJKLMNOPQRSTUVWXYZ>5"};
+
+    for (const char* rule : rules)
+    {
+        TimeZone zone;
+
+        ASSERT_TRUE(zone.loadRule(rule));
+
+        for (const char* format : formats)
+        {
+            const FormatProgram program = Parser::CompileFormat(format);
+            FormatProgram interpreted   = program;
+            Clock clock(0, zone);
+
+            interpreted.layout = Layout::Generic;
+
+            // From year 1 to year 9999, the years that aren't four digits long being left to the interpreter
+            for (int64_t instant = -62135596800; instant < 253402300800; instant += 86399 * 97) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            {
+                string expected;
+                string output;
+
+                clock.setInstant(static_cast<time_t>(instant));
+                Parser::RenderFormat(interpreted, clock.getSnapshot(), expected);
+                Parser::RenderFormat(program, clock.getSnapshot(), output);
+
+                ASSERT_EQ(output, expected) << format << " " << rule;
+            }
+        }
+    }
+}
+
+TEST(ParserFormatTests, Iso8601LayoutOutput)
+{
+    const FormatProgram program = Parser::CompileFormat("+%Y-%m-%dT%T");
+    string output;
+
+    ASSERT_EQ(program.layout, Layout::Iso8601);
+
+    Parser::RenderFormat(program, Clock(timespec{1700000000, 0}, TimeZone::Utc()).getSnapshot(), output); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    EXPECT_EQ(output, "2023-11-14T22:13:20");
+}
+
+TEST(ParserFormatTests, CompiledFormatExecutedTwice)
+{
+    MockClock first;
+    MockClock second;
+    FormatProgram program = Parser::CompileFormat("+%H:%M");
+    string output;
+
+    ON_CALL(first, getHour()).WillByDefault(Return(9));   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    ON_CALL(first, getMin()).WillByDefault(Return(5));    // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    ON_CALL(second, getHour()).WillByDefault(Return(23)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    ON_CALL(second, getMin()).WillByDefault(Return(59));  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    Parser::ExecuteFormat(program, first, output);
+    output += ' ';
+    Parser::ExecuteFormat(program, second, output);
+
+    EXPECT_EQ(output, "09:05 23:59");
+}
+
+TEST(ParserFormatTests, FractionOfSecond)
+{
+    MockClock clock;
+
+    ON_CALL(clock, getSec()).WillByDefault(Return(7));               // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    ON_CALL(clock, getNanosecond()).WillByDefault(Return(12345678)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    EXPECT_EQ(Parser::ParseFormat("+%S.%N", clock), "07.012345678\n");
+    EXPECT_EQ(Parser::ParseFormat("+%S.%3N", clock), "07.012\n");
+    EXPECT_EQ(Parser::ParseFormat("+%S.%6N", clock), "07.012345\n");
+    EXPECT_EQ(Parser::ParseFormat("+%1N %9N", clock), "0 012345678\n");
+    EXPECT_EQ(Parser::ParseFormat("+%0N%3X", clock), "%0N%3X\n");
+}
+
+TEST(ParserFormatTests, ClockKeepsNanoseconds)
+{
+    Clock clock(timespec{1700000000, 999999999}, TimeZone::Utc()); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    EXPECT_EQ(Parser::ParseFormat("+%T.%N", clock), "22:13:20.999999999\n");
+
+    clock.setInstant(timespec{1700000001, 500}); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Parser::ParseFormat("+%T.%6N", clock), "22:13:21.000000\n");
+
+    clock.setInstant(static_cast<time_t>(1700000002)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(clock.getNanosecond(), 0);
+}
+
+TEST(ParserFormatTests, CoarseClockIsCurrent)
+{
+    const timespec precise = Clock::readTime(false);
+    const timespec coarse  = Clock::readTime(true);
+
+    // The coarse clock lags behind by at most a few scheduler ticks
+    EXPECT_LT(std::abs(coarse.tv_sec - precise.tv_sec), 2);
+    EXPECT_GE(coarse.tv_nsec, 0);
+    EXPECT_LT(coarse.tv_nsec, 1000000000); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+TEST(ParserFormatTests, RendersSnapshot)
+{
+    Snapshot snapshot{2025, 6, 14, 7, 3, 9, 0, 1, "CEST"}; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    string output;
+
+    Parser::RenderFormat(Parser::CompileFormat("+%A %d %B %Y %T %Z"), snapshot, output);
+
+    EXPECT_EQ(output, "Monday 14 July 2025 07:03:09 CEST");
+}
+
+TEST(ParserFormatTests, SnapshotMatchesClock)
+{
+    Clock clock(1700000000, true); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    FormatProgram program = Parser::CompileFormat("+%a %b %e %H:%M:%S %Z %Y %y %m");
+    string fromClock;
+    string fromSnapshot;
+
+    Parser::ExecuteFormat(program, clock, fromClock);
+    Parser::RenderFormat(program, clock.getSnapshot(), fromSnapshot);
+
+    EXPECT_EQ(fromSnapshot, fromClock);
+}
+
+TEST(ParserFormatTests, FormatsWithOneAllocation)
+{
+    const Clock clock(timespec{1700000000, 123456789}, TimeZone::Utc()); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    const std::array<string, 6> formats = {
+        "+%a %b %e %H:%M:%S %Z %Y",
+        "+%A %d %B %Y, %R:%S.%N %Z",
+        "+%Y-%m-%dT%T.%3N",
+        "+%a, %d %b %Y %T %Z",
+        "+Written on %A, the %e of %B %Y, at %T and %6N microseconds (%Z, %y/%m/%d)",
+        "+%% %x %0N %",
+    };
+
+    for (const string& format : formats)
+    {
+        const size_t before = allocations;
+        const string date   = Parser::ParseFormat(format, clock);
+
+        EXPECT_LE(allocations - before, 1U) << format;
+
+        const FormatProgram program = Parser::CompileFormat(format);
+        const size_t compiled       = allocations;
+        string output;
+
+        Parser::RenderFormat(program, clock.getSnapshot(), output);
+
+        EXPECT_LE(allocations - compiled, 1U) << format;
+        EXPECT_LE(output.size(), program.maxLength) << format;
+        EXPECT_EQ(output + "\n", date);
+    }
+}
+
+TEST(ParserFormatTests, FormatsShortYears)
+{
+    MockClock clock;
+    MockClock beforeYearZero;
+
+    ON_CALL(clock, getYear()).WillByDefault(Return(5));             // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    ON_CALL(clock, getDay()).WillByDefault(Return(123));            // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    ON_CALL(beforeYearZero, getYear()).WillByDefault(Return(-107)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    EXPECT_EQ(Parser::ParseFormat("+%y %Y %e %d", clock), "05 5 123 123\n");
+    EXPECT_EQ(Parser::ParseFormat("+%y %Y", beforeYearZero), "07 -107\n");
+}
+
+TEST(IncrementalFormatTests, MatchesFullRendering)
+{
+    FormatProgram program = Parser::CompileFormat("+%a %e %b %Y %T.%3N %Z|%A %B %d/%m/%y %R %S %N");
+    IncrementalFormat format(program);
+    Clock clock(0, TimeZone::Utc());
+    TimeZone paris;
+    string expected;
+
+    paris.loadRule("CET-1CEST,M3.5.0,M10.5.0/3");
+
+    Clock local(0, paris);
+
+    // Steps of various sizes, so that every field changes, with and without a change of width
+    for (int64_t instant = 1700000000, step = 1; instant < 1800000000; instant += step, step = step * 7 % 1000003) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        clock.setInstant(timespec{instant, static_cast<long>(step * 997 % 1000000000)}); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        local.setInstant(static_cast<time_t>(instant));
+
+        for (const Clock* source : {&clock, &local})
+        {
+            expected.clear();
+            Parser::RenderFormat(program, source->getSnapshot(), expected);
+            ASSERT_EQ(format.update(source->getSnapshot()), expected) << "instant " << instant;
+        }
+    }
+}
+
+TEST(TickerTests, ParsesIntervals)
+{
+    EXPECT_EQ(Ticker::ParseInterval("1"), 1000000000);        // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Ticker::ParseInterval("0.25"), 250000000);      // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Ticker::ParseInterval(".5"), 500000000);        // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Ticker::ParseInterval("60"), 60000000000);      // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Ticker::ParseInterval("0.0000000019"), 1);
+    EXPECT_EQ(Ticker::ParseInterval(""), 0);
+    EXPECT_EQ(Ticker::ParseInterval("."), 0);
+    EXPECT_EQ(Ticker::ParseInterval("0"), 0);
+    EXPECT_EQ(Ticker::ParseInterval("1s"), 0);
+    EXPECT_EQ(Ticker::ParseInterval("-1"), 0);
+    EXPECT_EQ(Ticker::ParseInterval("99999999999999999999"), 0);
+}
+
+TEST(TickerTests, TicksOnBoundaries)
+{
+    std::array<int, 2> output    = {};
+    std::array<char, 256> buffer = {}; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    string received;
+    ssize_t count = 0;
+
+    ASSERT_EQ(pipe(output.data()), 0);
+    ASSERT_TRUE(Ticker::Run(output[1], Parser::CompileFormat("+%S.%3N"), TimeZone::Utc(), 20000000, 5)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    close(output[1]);
+
+    while ((count = read(output[0], buffer.data(), buffer.size())) > 0)
+    {
+        received.append(buffer.data(), static_cast<size_t>(count));
+    }
+
+    close(output[0]);
+
+    // Five lines of "SS.mmm\n", each on a 20 ms boundary, 20 ms after the previous one
+    ASSERT_EQ(received.size(), 35U); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    int previous = -1;
+
+    for (size_t line = 0; line < 5; line++) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        const int milliseconds = std::stoi(received.substr(line * 7, 2)) * 1000 + std::stoi(received.substr(line * 7 + 3, 3)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+        EXPECT_EQ(milliseconds % 20, 0) << received;
+        EXPECT_TRUE(previous < 0 || (milliseconds - previous + 60000) % 60000 == 20) << received; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        previous = milliseconds;
+    }
+}
+
+TEST(BatchTests, FormatsEpochValues)
+{
+    std::array<int, 2> input  = {};
+    std::array<int, 2> output = {};
+    string values             = "0\n86400\n  -1\r\nnot a number\n1700000000";
+    string received;
+    std::array<char, 256> buffer = {}; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    ssize_t count                = 0;
+
+    ASSERT_EQ(pipe(input.data()), 0);
+    ASSERT_EQ(pipe(output.data()), 0);
+    ASSERT_EQ(write(input[1], values.data(), values.size()), static_cast<ssize_t>(values.size()));
+    close(input[1]);
+
+    EXPECT_FALSE(Batch::FormatEpochs(input[0], output[1], Parser::CompileFormat("+%Y %b %d %T"), true));
+    close(input[0]);
+    close(output[1]);
+
+    while ((count = read(output[0], buffer.data(), buffer.size())) > 0)
+    {
+        received.append(buffer.data(), static_cast<size_t>(count));
+    }
+
+    close(output[0]);
+
+    EXPECT_EQ(received, "1970 Jan 01 00:00:00\n1970 Jan 02 00:00:00\n1969 Dec 31 23:59:59\n2023 Nov 14 22:13:20\n");
+}
+
+TEST(StamperTests, ResolutionFollowsFraction)
+{
+    EXPECT_EQ(Stamper::Resolution(Parser::CompileFormat("+%T")), 1000000000);      // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Stamper::Resolution(Parser::CompileFormat("+%T.%3N")), 1000000);     // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Stamper::Resolution(Parser::CompileFormat("+%1N %N")), 1);
+}
+
+TEST(StamperTests, PrefixesEveryLine)
+{
+    std::array<int, 2> input  = {};
+    std::array<int, 2> output = {};
+    string lines              = "one\n\ntwo\r\nthree";
+    string prefix             = std::to_string(Clock(true).getYear()) + "| ";
+    string received;
+    std::array<char, 256> buffer = {}; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    ssize_t count                = 0;
+
+    ASSERT_EQ(pipe(input.data()), 0);
+    ASSERT_EQ(pipe(output.data()), 0);
+    ASSERT_EQ(write(input[1], lines.data(), lines.size()), static_cast<ssize_t>(lines.size()));
+    close(input[1]);
+
+    EXPECT_TRUE(Stamper::PrefixLines(input[0], output[1], Parser::CompileFormat("+%Y| "), TimeZone::Utc(), false));
+    close(input[0]);
+    close(output[1]);
+
+    while ((count = read(output[0], buffer.data(), buffer.size())) > 0)
+    {
+        received.append(buffer.data(), static_cast<size_t>(count));
+    }
+
+    close(output[0]);
+
+    // The last line has no newline, and gets none
+    EXPECT_EQ(received, prefix + "one\n" + prefix + "\n" + prefix + "two\r\n" + prefix + "three");
+}
+
+TEST(StamperTests, PrefixesLinesLongerThanABlock)
+{
+    FILE* input  = tmpfile();
+    FILE* output = tmpfile();
+    string lines = string(3000000, 'a') + "\n" + string(2000000, 'b') + "\nc\n"; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    string received(lines.size() + 100, '\0');                                     // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    ASSERT_NE(input, nullptr);
+    ASSERT_NE(output, nullptr);
+    ASSERT_EQ(write(fileno(input), lines.data(), lines.size()), static_cast<ssize_t>(lines.size()));
+    ASSERT_EQ(lseek(fileno(input), 0, SEEK_SET), 0);
+
+    EXPECT_TRUE(Stamper::PrefixLines(fileno(input), fileno(output), Parser::CompileFormat("+> "), TimeZone::Utc(), true));
+    ASSERT_EQ(lseek(fileno(output), 0, SEEK_SET), 0);
+    received.resize(static_cast<size_t>(read(fileno(output), received.data(), received.size())));
+    fclose(input);
+    fclose(output);
+
+    EXPECT_EQ(received, "> " + string(3000000, 'a') + "\n> " + string(2000000, 'b') + "\n> c\n"); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+TEST(CalendarTests, ShiftMatchesBreakDown)
+{
+    const std::array<int64_t, 6> offsets = {0, 3600, -3600, 50400, -43200, 2 * 86400 + 1}; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    for (int64_t seconds = -5000000000; seconds < 5000000000; seconds += 86399 * 3) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        for (int64_t offset : offsets)
+        {
+            const Snapshot expected = breakDown(seconds + offset);
+            const Snapshot shifted  = shiftBreakDown(breakDown(seconds), offset);
+
+            ASSERT_EQ(shifted.year, expected.year) << seconds << " " << offset;
+            ASSERT_EQ(shifted.month, expected.month) << seconds << " " << offset;
+            ASSERT_EQ(shifted.day, expected.day) << seconds << " " << offset;
+            ASSERT_EQ(shifted.hour, expected.hour) << seconds << " " << offset;
+            ASSERT_EQ(shifted.minute, expected.minute) << seconds << " " << offset;
+            ASSERT_EQ(shifted.second, expected.second) << seconds << " " << offset;
+            ASSERT_EQ(shifted.dayOfTheWeek, expected.dayOfTheWeek) << seconds << " " << offset;
+        }
+    }
+}
+
+TEST(MultiZoneTests, MatchesOneClockPerZone)
+{
+    const std::array<const char*, 5> names = {"", "CET-1CEST,M3.5.0,M10.5.0/3", "<+1345>-13:45<+1445>,M9.5.0/2:45,M4.1.0/3:45", "EST5EDT", "NZST-12NZDT,M9.5.0,M4.1.0/3"};
+    const FormatProgram program            = Parser::CompileFormat("+%a %d %b %Y %T.%3N %Z");
+    MultiZone zones;
+    std::vector<TimeZone> references(names.size());
+
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        ASSERT_TRUE(zones.add(names.at(i)));
+        ASSERT_TRUE(references.at(i).loadName(names.at(i)));
+    }
+
+    EXPECT_FALSE(zones.add("Not/A/Zone"));
+    ASSERT_EQ(zones.size(), names.size());
+
+    for (int64_t instant = 0; instant < 4000000000; instant += 3600 * 13 + 7) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        string output;
+        string expected;
+
+        zones.render(timespec{static_cast<time_t>(instant), 250000000}, program, output); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+        for (const TimeZone& zone : references)
+        {
+            Clock clock(timespec{static_cast<time_t>(instant), 250000000}, zone); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+            Parser::RenderFormat(program, clock.getSnapshot(), expected);
+            expected += '\n';
+        }
+
+        ASSERT_EQ(output, expected) << instant;
+    }
+}
+
+TEST(RangeTests, ParsesSteps)
+{
+    EXPECT_EQ(Range::ParseStep("30").seconds, 30);                  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Range::ParseStep("15m").seconds, 900);                // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Range::ParseStep("2h").seconds, 7200);                // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Range::ParseStep("1d").days, 1);                      // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Range::ParseStep("2w").days, 14);                     // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Range::ParseStep("3M").months, 3);                    // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Range::ParseStep("2y").months, 24);                   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    for (const char* step : {"", "0", "h", "1x", "1hh", "-1h", "99999999999999999999"})
+    {
+        EXPECT_EQ(Range::ParseStep(step).seconds, 0) << step;
+        EXPECT_EQ(Range::ParseStep(step).days, 0) << step;
+        EXPECT_EQ(Range::ParseStep(step).months, 0) << step;
+    }
+
+    EXPECT_TRUE(Range::Parse("2024-01-01/2024-12-31T23:00:00/1h", TimeZone::Utc()).isValid);
+    EXPECT_TRUE(Range::Parse("2024-01-01T00:00:00+01:00/2024-01-02/1d", TimeZone::Utc()).isValid);
+    EXPECT_FALSE(Range::Parse("2024-01-01/2024-12-31", TimeZone::Utc()).isValid);
+    EXPECT_FALSE(Range::Parse("2024-01-01/2024-13-01/1h", TimeZone::Utc()).isValid);
+    EXPECT_FALSE(Range::Parse("2024-01-01/2024-12-31/1q", TimeZone::Utc()).isValid);
+}
+
+TEST(RangeTests, MatchesOneClockPerInstant)
+{
+    TimeZone paris;
+    FILE* output                = tmpfile();
+    const FormatProgram program = Parser::CompileFormat("+%a %d %b %Y %T.%3N %Z");
+    string expected;
+
+    ASSERT_TRUE(paris.loadRule("CET-1CEST,M3.5.0,M10.5.0/3"));
+    ASSERT_NE(output, nullptr);
+
+    // Every 7 minutes for a year, across both changes of offset and more than a block of output
+    const DateRange range = Range::Parse("2023-12-31T22:00:00.5/2025-01-01/7m", paris);
+
+    ASSERT_TRUE(range.isValid);
+    EXPECT_TRUE(Range::Generate(fileno(output), program, paris, range));
+
+    for (int64_t instant = range.start.tv_sec; instant <= range.end.tv_sec; instant += 420) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        Parser::RenderFormat(program, Clock(timespec{static_cast<time_t>(instant), range.start.tv_nsec}, paris).getSnapshot(), expected);
+        expected += '\n';
+    }
+
+    string received(expected.size() + 100, '\0'); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    ASSERT_EQ(lseek(fileno(output), 0, SEEK_SET), 0);
+    received.resize(static_cast<size_t>(read(fileno(output), received.data(), received.size())));
+    fclose(output);
+
+    EXPECT_GT(received.size(), size_t{1024 * 1024});
+    EXPECT_EQ(received, expected);
+}
+
+TEST(RangeTests, MonthlyStepsKeepTheDay)
+{
+    TimeZone paris;
+    FILE* output = tmpfile();
+    string received(1024, '\0'); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    ASSERT_TRUE(paris.loadRule("CET-1CEST,M3.5.0,M10.5.0/3"));
+    ASSERT_NE(output, nullptr);
+
+    // March 31st 02:30 doesn't exist in Paris, and is printed as the instant it was moved to
+    EXPECT_TRUE(Range::Generate(fileno(output), Parser::CompileFormat("+%Y %d %b %a %T %Z"), paris, Range::Parse("2024-01-31T02:30:00/2024-06-30/1M", paris)));
+    ASSERT_EQ(lseek(fileno(output), 0, SEEK_SET), 0);
+    received.resize(static_cast<size_t>(read(fileno(output), received.data(), received.size())));
+    fclose(output);
+
+    EXPECT_EQ(received, "2024 31 Jan Wed 02:30:00 CET\n"
+                        "2024 29 Feb Thu 02:30:00 CET\n"
+                        "2024 31 Mar Sun 03:30:00 CEST\n"
+                        "2024 30 Apr Tue 02:30:00 CEST\n"
+                        "2024 31 May Fri 02:30:00 CEST\n");
+}
+
+TEST(RangeTests, DailyStepsKeepTheTime)
+{
+    TimeZone paris;
+    FILE* output = tmpfile();
+    string received(1024, '\0'); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    ASSERT_TRUE(paris.loadRule("CET-1CEST,M3.5.0,M10.5.0/3"));
+    ASSERT_NE(output, nullptr);
+
+    // Days of 25 and 23 hours, at the end of October and of March
+    EXPECT_TRUE(Range::Generate(fileno(output), Parser::CompileFormat("+%Y-%m-%d %T %Z"), paris, Range::Parse("2024-10-25/2024-10-29/1d", paris)));
+    EXPECT_TRUE(Range::Generate(fileno(output), Parser::CompileFormat("+%Y-%m-%d %T %Z"), paris, Range::Parse("2025-03-16T02:30:00/2025-04-14/1w", paris)));
+    ASSERT_EQ(lseek(fileno(output), 0, SEEK_SET), 0);
+    received.resize(static_cast<size_t>(read(fileno(output), received.data(), received.size())));
+    fclose(output);
+
+    EXPECT_EQ(received, "2024-10-25 00:00:00 CEST\n"
+                        "2024-10-26 00:00:00 CEST\n"
+                        "2024-10-27 00:00:00 CEST\n"
+                        "2024-10-28 00:00:00 CET\n"
+                        "2024-10-29 00:00:00 CET\n"
+                        "2025-03-16 02:30:00 CET\n"
+                        "2025-03-23 02:30:00 CET\n"
+                        "2025-03-30 03:30:00 CEST\n"
+                        "2025-04-06 02:30:00 CEST\n"
+                        "2025-04-13 02:30:00 CEST\n");
+}
+
+TEST(RangeTests, CalendarStepsStartAtTheStart)
+{
+    TimeZone paris;
+    FILE* output = tmpfile();
+    string received(1024, '\0'); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    ASSERT_TRUE(paris.loadRule("CET-1CEST,M3.5.0,M10.5.0/3"));
+    ASSERT_NE(output, nullptr);
+
+    // 01:30Z is the second time 02:30 occurs on October 26th, in CET
+    EXPECT_TRUE(Range::Generate(fileno(output), Parser::CompileFormat("+%Y-%m-%d %T %Z"), paris, Range::Parse("2025-10-26T01:30:00Z/2025-10-28T00:00:00Z/1d", paris)));
+    ASSERT_EQ(lseek(fileno(output), 0, SEEK_SET), 0);
+    received.resize(static_cast<size_t>(read(fileno(output), received.data(), received.size())));
+    fclose(output);
+
+    EXPECT_EQ(received, "2025-10-26 02:30:00 CET\n"
+                        "2025-10-27 02:30:00 CET\n");
+}
+
+TEST(NameTests, FindsEveryName)
+{
+    for (int day = 0; day < 7; day++) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        string upper(getLongDayName(day));
+
+        std::transform(upper.begin(), upper.end(), upper.begin(), [](char letter) { return static_cast<char>(toupper(letter)); });
+
+        EXPECT_EQ(shortDayName(day), getShortDayName(day));
+        EXPECT_EQ(findShortDayName(getShortDayName(day)), static_cast<Day>(day));
+        EXPECT_EQ(findLongDayName(upper), static_cast<Day>(day));
+        EXPECT_FALSE(findShortDayName(getLongDayName(day)));
+    }
+
+    for (int month = 0; month < 12; month++) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        string lower(getLongMonthName(month));
+
+        std::transform(lower.begin(), lower.end(), lower.begin(), [](char letter) { return static_cast<char>(tolower(letter)); });
+
+        EXPECT_EQ(longMonthName(month), getLongMonthName(month));
+        EXPECT_EQ(findShortMonthName(getShortMonthName(month)), static_cast<Month>(month));
+        EXPECT_EQ(findLongMonthName(lower), static_cast<Month>(month));
+        EXPECT_FALSE(findLongMonthName(lower + "s"));
+    }
+
+    for (const char* name : {"", "J", "Ja", "Jam", "Mo", "Fr1", "Sun ", "Febuary", "@pr", "[ue"})
+    {
+        EXPECT_FALSE(findShortDayName(name)) << name;
+        EXPECT_FALSE(findShortMonthName(name)) << name;
+        EXPECT_FALSE(findLongMonthName(name)) << name;
+    }
+}
+
+TEST(CalendarTests, MatchesLibcFrom1900To2400)
+{
+    const int64_t first = daysFromCivil(1900, 1, 1);   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    const int64_t last  = daysFromCivil(2400, 12, 31); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    for (int64_t days = first; days <= last; days++)
+    {
+        // 12:34:56 on that day, so that every field of the time is checked too
+        const time_t instant = days * SECONDS_PER_DAY + 45296; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        tm expected          = {};
+
+        ASSERT_NE(gmtime_r(&instant, &expected), nullptr);
+
+        const CivilDate date    = civilFromDays(days);
+        const Snapshot snapshot = breakDown(instant);
+
+        ASSERT_EQ(date.year, expected.tm_year + 1900) << "day " << days;
+        ASSERT_EQ(date.month, static_cast<unsigned>(expected.tm_mon) + 1) << "day " << days;
+        ASSERT_EQ(date.day, static_cast<unsigned>(expected.tm_mday)) << "day " << days;
+        ASSERT_EQ(weekdayFromDays(days), static_cast<unsigned>(expected.tm_wday)) << "day " << days;
+        ASSERT_EQ(daysFromCivil(date.year, date.month, static_cast<int>(date.day)), days);
+        ASSERT_EQ(snapshot.year, expected.tm_year + 1900) << "day " << days;
+        ASSERT_EQ(snapshot.month, expected.tm_mon) << "day " << days;
+        ASSERT_EQ(snapshot.day, expected.tm_mday) << "day " << days;
+        ASSERT_EQ(snapshot.hour, expected.tm_hour) << "day " << days;
+        ASSERT_EQ(snapshot.minute, expected.tm_min) << "day " << days;
+        ASSERT_EQ(snapshot.second, expected.tm_sec) << "day " << days;
+        ASSERT_EQ(snapshot.dayOfTheWeek, expected.tm_wday) << "day " << days;
+        ASSERT_EQ(secondsFromCivil(date.year, date.month, static_cast<int>(date.day), 12, 34, 56), instant); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        ASSERT_EQ(timegm(&expected), instant);
+    }
+}
+
+TEST(CalendarTests, BreaksDownNegativeSeconds)
+{
+    const Snapshot snapshot = breakDown(-1);
+
+    EXPECT_EQ(snapshot.year, 1969); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(snapshot.month, 11);  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(snapshot.day, 31);    // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(snapshot.hour, 23);   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(snapshot.minute, 59); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(snapshot.second, 59); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(snapshot.dayOfTheWeek, 3);
+}
+
+TEST(CalendarTests, ClockMatchesLocaltime)
+{
+    for (time_t instant = -2208988800; instant < 4102444800; instant += 7776013) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        Clock clock(instant, false);
+        tm expected = {};
+
+        ASSERT_NE(localtime_r(&instant, &expected), nullptr);
+        ASSERT_EQ(clock.getYear(), expected.tm_year + 1900) << "instant " << instant;
+        ASSERT_EQ(clock.getMonth(), expected.tm_mon) << "instant " << instant;
+        ASSERT_EQ(clock.getDay(), expected.tm_mday) << "instant " << instant;
+        ASSERT_EQ(clock.getHour(), expected.tm_hour) << "instant " << instant;
+        ASSERT_EQ(clock.getMin(), expected.tm_min) << "instant " << instant;
+        ASSERT_EQ(clock.getSec(), expected.tm_sec) << "instant " << instant;
+        ASSERT_EQ(clock.getDayOfTheWeek(), expected.tm_wday) << "instant " << instant;
+    }
+}
+
+TEST(CalendarTests, ParseDateMatchesMktime)
+{
+    tm expected = {};
+
+    expected.tm_year  = 125; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    expected.tm_mon   = 6;   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    expected.tm_mday  = 4;   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    expected.tm_hour  = 12;  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    expected.tm_min   = 30;  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    expected.tm_sec   = 45;  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    expected.tm_isdst = -1;
+
+    const DateResult result = Parser::ParseDate("070412302025.45", 2000, TimeZone::Local()); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    EXPECT_EQ(result.error, OperandError::None);
+    EXPECT_EQ(result.time.tv_sec, mktime(&expected));
+    EXPECT_EQ(result.time.tv_nsec, 0);
+}
+
+TEST(OperandTests, AcceptsEveryForm)
+{
+    TimeOperand operand = parseTimeOperand("07041230", 2031); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    EXPECT_EQ(operand.error, OperandError::None);
+    EXPECT_EQ(operand.year, 2031);  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(operand.month, 7U);   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(operand.day, 4);      // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(operand.hour, 12);    // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(operand.minute, 30);  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(operand.second, 0);
+
+    EXPECT_EQ(parseTimeOperand("0704123068", 0).year, 2068);   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseTimeOperand("0704123069", 0).year, 1969);   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseTimeOperand("070412301850", 0).year, 1850); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseTimeOperand("07041230.59", 0).second, 59);  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseTimeOperand("123123592016.60", 0).error, OperandError::None);
+}
+
+TEST(OperandTests, RejectsInvalidOperands)
+{
+    EXPECT_EQ(parseTimeOperand("", 0).error, OperandError::Length);
+    EXPECT_EQ(parseTimeOperand("0704123", 0).error, OperandError::Length);
+    EXPECT_EQ(parseTimeOperand("070412302", 0).error, OperandError::Length);
+    EXPECT_EQ(parseTimeOperand("0704123020251", 0).error, OperandError::Length);
+    EXPECT_EQ(parseTimeOperand("07041230.5", 0).error, OperandError::Digit);
+    EXPECT_EQ(parseTimeOperand("07041230x5", 0).error, OperandError::Digit);
+    EXPECT_EQ(parseTimeOperand("07041230.5a", 0).error, OperandError::Digit);
+    EXPECT_EQ(parseTimeOperand("0704 230", 0).error, OperandError::Digit);
+    EXPECT_EQ(parseTimeOperand("13041230", 0).error, OperandError::Month);
+    EXPECT_EQ(parseTimeOperand("00041230", 0).error, OperandError::Month);
+    EXPECT_EQ(parseTimeOperand("04311230", 0).error, OperandError::Day);
+    EXPECT_EQ(parseTimeOperand("04001230", 0).error, OperandError::Day);
+    EXPECT_EQ(parseTimeOperand("022912302100", 0).error, OperandError::Day);
+    EXPECT_EQ(parseTimeOperand("02291230", 2000).error, OperandError::None); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseTimeOperand("07042430", 0).error, OperandError::Hour);
+    EXPECT_EQ(parseTimeOperand("07041260", 0).error, OperandError::Minute);
+    EXPECT_EQ(parseTimeOperand("07041230.61", 0).error, OperandError::Second);
+    EXPECT_EQ(Parser::ParseDate("07041230.61", 0, TimeZone::Utc()).error, OperandError::Second);
+}
+
+TEST(OperandTests, ParsesUtcOperand)
+{
+    const DateResult result = Parser::ParseDate("111422132023.20", 0, TimeZone::Utc());
+
+    EXPECT_EQ(result.error, OperandError::None);
+    EXPECT_EQ(result.time.tv_sec, 1700000000); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+TEST(ScanTests, ReadsIso8601Timestamps)
+{
+    TimeZone paris;
+
+    paris.loadRule("CET-1CEST,M3.5.0,M10.5.0/3");
+
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14T22:13:20Z", paris).time.tv_sec, 1700000000);                                       // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14T23:13:20+01:00", paris).time.tv_sec, 1700000000);                                  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14t18:43:20-0330", paris).time.tv_sec, 1700000000);                                   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14 23:13:20", paris).time.tv_sec, 1700000000);                                        // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14T22:13:20.123456789123Z", paris).time.tv_nsec, 123456789);                          // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Parser::ScanIso8601("1969-12-31T23:59:59,5Z", paris).time.tv_sec, -1);                                             // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14T22:13:2", paris).error, OperandError::Length);
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14T22:13:20 ", paris).error, OperandError::Length);
+    EXPECT_EQ(Parser::ScanIso8601("2023/11/14T22:13:20", paris).error, OperandError::Digit);
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14X22:13:20", paris).error, OperandError::Digit);
+    EXPECT_EQ(Parser::ScanIso8601("2023-1a-14T22:13:20", paris).error, OperandError::Digit);
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14T22:13:20.Z", paris).error, OperandError::Digit);
+    EXPECT_EQ(Parser::ScanIso8601("2023-13-14T22:13:20", paris).error, OperandError::Month);
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-31T22:13:20", paris).error, OperandError::Day);
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14T24:13:20", paris).error, OperandError::Hour);
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14T22:13:20+1:00", paris).error, OperandError::Zone);
+    EXPECT_EQ(Parser::ScanIso8601("2023-11-14T22:13:20+24:00", paris).error, OperandError::Zone);
+}
+
+TEST(ScanTests, ReadsBackRenderedDates)
+{
+    const std::array<const char*, 4> formats = {"+%a %b %e %H:%M:%S %Z %Y", "+%A %d %B %y %R:%S.%N", "+%Y%d%H%M%S.%3N", "+%Y-%m-%dT%T"};
+    Clock clock(0, TimeZone::Utc());
+
+    for (const char* format : formats)
+    {
+        const FormatProgram program = Parser::CompileFormat(format);
+        const bool hasMonth         = std::any_of(program.tokens.begin(), program.tokens.end(), [](const Token& token)
+                                                  { return token.opcode == Opcode::ShortMonth || token.opcode == Opcode::LongMonth || token.opcode == Opcode::Month; });
+        string text;
+
+        // %y only goes round 1969–2068
+        for (int64_t instant = -15000000; instant < 3100000000; instant += 7654321) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        {
+            clock.setInstant(timespec{instant, 123000000}); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+            text.clear();
+            Parser::RenderFormat(program, clock.getSnapshot(), text);
+
+            const DateResult date = Parser::ScanFormat(program, text, TimeZone::Utc());
+
+            ASSERT_EQ(date.error, OperandError::None) << format << " " << text;
+
+            // Formats without a month only go round when the instant is in January
+            if (!hasMonth && clock.getMonth() != 0)
+            {
+                continue;
+            }
+
+            EXPECT_EQ(date.time.tv_sec, instant) << format << " " << text;
+        }
+    }
+}
+
+TEST(ScanTests, RejectsMismatchedText)
+{
+    const FormatProgram program = Parser::CompileFormat("+%a %b %e %T %Z %Y");
+
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov 14 22:13:20 UTC 2023", TimeZone::Utc()).time.tv_sec, 1700000000); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov 14 23:13:20 CET 2023", TimeZone::Utc()).time.tv_sec, 1700003600); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov  4 22:13:20 UTC 2023", TimeZone::Utc()).error, OperandError::None);
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov 14 22:13:20 UTC 2023 ", TimeZone::Utc()).error, OperandError::Length);
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov 14 22:13:20 UTC", TimeZone::Utc()).error, OperandError::Literal);
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov 14 22:13", TimeZone::Utc()).error, OperandError::Literal);
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov 14 22-13:20 UTC 2023", TimeZone::Utc()).error, OperandError::Literal);
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov 1x 22:13:20 UTC 2023", TimeZone::Utc()).error, OperandError::Literal);
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov 14 22:1x:20 UTC 2023", TimeZone::Utc()).error, OperandError::Digit);
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nom 14 22:13:20 UTC 2023", TimeZone::Utc()).error, OperandError::Name);
+    EXPECT_EQ(Parser::ScanFormat(program, "Tux Nov 14 22:13:20 UTC 2023", TimeZone::Utc()).error, OperandError::Name);
+    EXPECT_EQ(Parser::ScanFormat(program, "TUE nov 14 22:13:20 UTC 2023", TimeZone::Utc()).time.tv_sec, 1700000000); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov 14 22:13:20  2023", TimeZone::Utc()).error, OperandError::Zone);
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov 31 22:13:20 UTC 2023", TimeZone::Utc()).error, OperandError::Day);
+    EXPECT_EQ(Parser::ScanFormat(program, "Tue Nov 14 22:13:61 UTC 2023", TimeZone::Utc()).error, OperandError::Second);
+    EXPECT_EQ(Parser::ScanFormat(Parser::CompileFormat("+%m/%d"), "00/14", TimeZone::Utc()).error, OperandError::Month);
+    EXPECT_TRUE(Parser::IsIso8601(Parser::CompileFormat("+%Y-%m-%dT%T")));
+    EXPECT_TRUE(Parser::IsIso8601(Parser::CompileFormat("+%Y-%m-%d %T.%3N")));
+    EXPECT_FALSE(Parser::IsIso8601(Parser::CompileFormat("+%Y-%m-%dT%T %Z")));
+}
+
+TEST(BatchTests, ScansDates)
+{
+    std::array<int, 2> input  = {};
+    std::array<int, 2> output = {};
+    string dates              = "2023-11-14T22:13:20Z\r\n1969-12-31T23:59:59.25Z\nyesterday\n1970-01-01T00:00:00.5+00:00";
+    string received;
+    std::array<char, 256> buffer = {}; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    ssize_t count                = 0;
+
+    ASSERT_EQ(pipe(input.data()), 0);
+    ASSERT_EQ(pipe(output.data()), 0);
+    ASSERT_EQ(write(input[1], dates.data(), dates.size()), static_cast<ssize_t>(dates.size()));
+    close(input[1]);
+
+    EXPECT_FALSE(Batch::ScanDates(input[0], output[1], Parser::CompileFormat("+%Y-%m-%dT%T"), TimeZone::Utc()));
+    close(input[0]);
+    close(output[1]);
+
+    while ((count = read(output[0], buffer.data(), buffer.size())) > 0)
+    {
+        received.append(buffer.data(), static_cast<size_t>(count));
+    }
+
+    close(output[0]);
+
+    EXPECT_EQ(received, "1700000000\n-0.750000000\n0.500000000\n");
+}
+
+// Compares a zone with the C library's conversion under the same TZ, every few days until 2100
+void ExpectZoneMatchesLibc(const TimeZone& zone, const char* variable, time_t first)
+{
+    const char* previous = getenv("TZ");
+    string saved         = previous != nullptr ? previous : "";
+
+    setenv("TZ", variable, 1);
+    tzset();
+
+    for (time_t instant = first; instant < 4102444800; instant += 259201) // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    {
+        tm expected             = {};
+        const ZonePeriod period = zone.find(instant);
+
+        ASSERT_NE(localtime_r(&instant, &expected), nullptr);
+        ASSERT_TRUE(period.contains(instant)) << variable << " at " << instant;
+        ASSERT_EQ(period.offset, expected.tm_gmtoff) << variable << " at " << instant;
+        ASSERT_EQ(period.isDst, expected.tm_isdst > 0) << variable << " at " << instant;
+        ASSERT_EQ(period.abbreviation, expected.tm_zone) << variable << " at " << instant;
+    }
+
+    if (previous != nullptr)
+    {
+        setenv("TZ", saved.c_str(), 1);
+    }
+    else
+    {
+        unsetenv("TZ");
+    }
+
+    tzset();
+}
+
+TEST(TimeZoneTests, DefaultIsUtc)
+{
+    const ZonePeriod period = TimeZone().find(1700000000); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    EXPECT_EQ(period.offset, 0);
+    EXPECT_EQ(period.abbreviation, "UTC");
+    EXPECT_TRUE(period.contains(-1700000000)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+TEST(TimeZoneTests, RejectsInvalidInput)
+{
+    TimeZone zone;
+
+    EXPECT_FALSE(zone.load("/nonexistent/zone"));
+    EXPECT_FALSE(zone.load("/proc/self/cmdline"));
+    EXPECT_FALSE(zone.loadRule("CE"));
+    EXPECT_FALSE(zone.loadRule("CET-1CEST,M3.5.0"));
+    EXPECT_FALSE(zone.loadRule("CET-1CEST,M13.5.0,M10.5.0/3"));
+    EXPECT_EQ(zone.find(0).abbreviation, "UTC");
+}
+
+TEST(TimeZoneTests, PosixRulesMatchLibc)
+{
+    for (const char* rule : {"UTC0", "EST5EDT,M3.2.0,M11.1.0", "CET-1CEST,M3.5.0,M10.5.0/3", "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0",
+                             "AEST-10AEDT,M10.1.0,M4.1.0/3", "NZST-12NZDT,M9.5.0,M4.1.0/3", "IST-1GMT0,M10.5.0,M3.5.0/1", "XXX3YYY,J60/1,300/-1"})
+    {
+        TimeZone zone;
+
+        // The C library doesn't apply the rules of TZ strings before the Epoch
+        ASSERT_TRUE(zone.loadRule(rule)) << rule;
+        ExpectZoneMatchesLibc(zone, rule, 0);
+    }
+}
+
+TEST(TimeZoneTests, ZoneFilesMatchLibc)
+{
+    for (const char* name : {"Europe/Paris", "America/New_York", "Australia/Lord_Howe", "Asia/Kolkata", "Pacific/Apia", "America/Sao_Paulo"})
+    {
+        TimeZone zone;
+
+        if (!zone.load(string("/usr/share/zoneinfo/") + name))
+        {
+            GTEST_SKIP() << "No zoneinfo file for " << name;
+        }
+
+        ExpectZoneMatchesLibc(zone, name, -2208988800); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    }
+}
+
+TEST(TimeZoneTests, LocalTimesAroundChanges)
+{
+    TimeZone paris;
+    TimeZone newYork;
+
+    ASSERT_TRUE(paris.loadRule("CET-1CEST,M3.5.0,M10.5.0/3"));
+    ASSERT_TRUE(newYork.loadRule("EST5EDT,M3.2.0,M11.1.0"));
+
+    // Repeated by the change backward: the first time it occurs, before the change
+    EXPECT_EQ(paris.fromLocal(secondsFromCivil(2025, 10, 26, 2, 30, 0)), 1761438600);  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(newYork.fromLocal(secondsFromCivil(2025, 11, 2, 1, 30, 0)), 1762061400); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(paris.fromLocal(secondsFromCivil(2025, 10, 26, 3, 0, 0)), 1761444000);   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    // Skipped by the change forward: moved past it, with the offset in effect before the change
+    EXPECT_EQ(paris.fromLocal(secondsFromCivil(2025, 3, 30, 2, 30, 0)), 1743298200);   // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(newYork.fromLocal(secondsFromCivil(2025, 3, 9, 2, 30, 0)), 1741505400);  // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(paris.fromLocal(secondsFromCivil(2025, 3, 30, 3, 0, 0)), 1743296400);    // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    // Away from any change
+    EXPECT_EQ(paris.fromLocal(secondsFromCivil(2025, 7, 1, 12, 0, 0)), 1751364000);    // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(TimeZone::Utc().fromLocal(1700000000), 1700000000);                      // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+TEST(DigitTests, ZeroPaddedDigits)
+{
+    std::array<char, 9> digits = {};
+
+    writeTwoDigits(digits.data(), 7);
+    EXPECT_EQ(string(digits.data(), 2), "07");
+
+    writeDigits(digits.data(), 42, 3); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(string(digits.data(), 3), "042");
+
+    writeDigits(digits.data(), 123456789, 9); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(string(digits.data(), 9), "123456789");
+
+    writeDigits(digits.data(), 5000, 9); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(string(digits.data(), 9), "000005000");
+}
@@ -0,0 +1,243 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a custom version of the `echo` command in C++.
+ *  It handles various escape sequences, such as \a (alert), \b (backspace),
+ *  \n (newline), \t (tab), etc. It prints the command-line arguments with the
+ *  escape sequences interpreted correctly.
+ *
+ *  Usage: ./echo <string>
+ *
+ *  The following escape sequences are supported:
+ *      \a      : Alert
+ *      \b      : Backspace
+ *      \c      : Suppress the <newline> that otherwise follows the final argument in the output. All characters following the '\c' in the arguments shall be ignored.
+ *      \f      : Form-feed
+ *      \n      : Newline
+ *      \t      : Tab
+ *      \r      : Carriage return
+ *      \v      : Vertical tab
+ *      \\      : Backslash
+ *      \0num   : 8-bit octal value (num)
+ *
+ *  Note: More details on options and behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/echo.html
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "escapes.hpp"
+#include "scanner.hpp"
+
+/**
+ * @class Decoder
+ * @brief Resumable escape sequence decoder, fed with an argument one chunk at a time.
+ *
+ * The Decoder keeps the state needed to carry an escape sequence cut by the end of a chunk over to the
+ * next one (for instance `\01` at the end of a chunk and `2` at the start of the next one), so an argument
+ * of any size can be decoded and written in fixed-size pieces. Feeding the chunks of an argument then
+ * calling `Finish()` produces exactly the same bytes as decoding the argument in one go.
+ *
+ * Runs of characters that need no interpretation are found with `Scanner` and passed to the sink as views
+ * into the chunk, every interpreted escape sequence is passed as a one-byte view. No memory is allocated.
+ *
+ * Example usage:
+ * @code
+ * Decoder decoder;
+ * std::string decoded;
+ * auto sink = [&decoded](std::string_view piece) { decoded += piece; };
+ * decoder.Feed("Hello\\0", sink);
+ * decoder.Feed("41", sink);
+ * decoder.Finish(sink);
+ * decoded == "Hello!"
+ * @endcode
+ *
+ * @note Unlike `Parser::DecodeArgument()`, the Decoder can't know in advance whether the argument ends with
+ *       a backslash, in which case `Parser::DecodeArgument()` writes it without interpreting anything.
+ */
+class Decoder
+{
+private:
+    static constexpr int OCTAL           = 8;
+    static constexpr size_t OCTAL_DIGITS = 3;
+    static constexpr size_t MAX_SEQUENCE = 2 + OCTAL_DIGITS; // Longest escape sequence: \0 followed by three octal digits
+
+    /**
+     * @brief Interpretation of the escape sequence starting at a backslash.
+     */
+    struct Sequence
+    {
+        EscapeAction action; // What to do with the sequence, `Literal` and `Backslash` are written as they are
+        char value;          // Byte to write for `Replace`
+        size_t length;       // Number of characters of the sequence, backslash included. 0 if more input is needed
+    };
+
+    std::array<char, MAX_SEQUENCE> pending = {}; // Beginning of an escape sequence cut by the end of the previous chunk
+    size_t pendingSize                     = 0;  // Number of characters held in pending
+    bool stopped                           = false; // Set once a \c sequence has been met
+
+    /**
+     * @brief Interprets the escape sequence at the start of the given text.
+     *
+     * An octal sequence ends after three octal digits or at the first character that isn't one. Without
+     * any octal digit, `\0` is written as it is.
+     *
+     * @param text Text starting with a backslash.
+     * @param final True if no input follows the text. Otherwise, a sequence reaching the end of the text
+     *              may continue in the next chunk and is reported as incomplete.
+     * @return The interpretation of the sequence, with a length of 0 if the sequence is incomplete.
+     */
+    static auto ParseSequence(std::string_view, bool) -> Sequence;
+
+public:
+    /**
+     * @brief Decodes the next chunk of the argument.
+     *
+     * @param chunk The next characters of the argument.
+     * @param sink The callable receiving the decoded bytes, in order, as `std::string_view`. The views are
+     *             only valid for the duration of the call.
+     * @return True if a `\c` sequence has been met, in which case the rest of the input is ignored.
+     */
+    template <typename Sink>
+    auto Feed(std::string_view, Sink&&) -> bool;
+
+    /**
+     * @brief Signals the end of the argument, writing an escape sequence that was waiting for more input.
+     *
+     * The Decoder can then be fed a new argument.
+     *
+     * @param sink The callable receiving the decoded bytes.
+     * @return True if a `\c` sequence has been met.
+     */
+    template <typename Sink>
+    auto Finish(Sink&&) -> bool;
+};
+
+template <typename Sink>
+auto Decoder::Feed(std::string_view chunk, Sink&& sink) -> bool
+{
+    size_t start = 0; // Beginning of the run of characters written as they are
+
+    if (stopped)
+    {
+        return true;
+    }
+
+    // Completes the escape sequence left unfinished by the previous chunk
+    if (pendingSize != 0)
+    {
+        size_t taken = std::min(chunk.size(), MAX_SEQUENCE - pendingSize);
+
+        std::copy_n(chunk.begin(), taken, pending.begin() + static_cast<std::ptrdiff_t>(pendingSize));
+
+        Sequence sequence = ParseSequence(std::string_view(pending.data(), pendingSize + taken), false);
+
+        if (sequence.length == 0)
+        {
+            pendingSize += taken;
+            return false;
+        }
+
+        start       = sequence.length - pendingSize;
+        pendingSize = 0;
+
+        switch (sequence.action)
+        {
+        case EscapeAction::Replace:
+            sink(std::string_view(&sequence.value, 1));
+            break;
+        case EscapeAction::Stop:
+            stopped = true;
+            return true;
+        default:
+            sink(std::string_view(pending.data(), sequence.length));
+            break;
+        }
+    }
+
+    // Only backslashes are looked at, the characters in between are written in bulk
+    size_t i = Scanner::FindBackslash(chunk, start);
+
+    while (i < chunk.size())
+    {
+        Sequence sequence = ParseSequence(chunk.substr(i), false);
+
+        // The sequence may continue in the next chunk, so it is kept until then
+        if (sequence.length == 0)
+        {
+            std::copy(chunk.begin() + static_cast<std::ptrdiff_t>(i), chunk.end(), pending.begin());
+            pendingSize = chunk.size() - i;
+            break;
+        }
+
+        // Sequences written as they are stay in the current run
+        if (sequence.action == EscapeAction::Literal || sequence.action == EscapeAction::Backslash)
+        {
+            i = Scanner::FindBackslash(chunk, i + sequence.length);
+            continue;
+        }
+
+        if (i > start)
+        {
+            sink(chunk.substr(start, i - start));
+        }
+
+        // If the sequence is \c, it is an interrupt sequence so nothing after it is written
+        if (sequence.action == EscapeAction::Stop)
+        {
+            stopped = true;
+            return true;
+        }
+
+        sink(std::string_view(&sequence.value, 1));
+
+        start = i + sequence.length;
+        i     = Scanner::FindBackslash(chunk, start);
+    }
+
+    if (start < i)
+    {
+        sink(chunk.substr(start, i - start));
+    }
+
+    return false;
+}
+
+template <typename Sink>
+auto Decoder::Finish(Sink&& sink) -> bool
+{
+    if (stopped)
+    {
+        return true;
+    }
+
+    // Nothing follows the pending sequence anymore, so it is interpreted with what has been received
+    if (pendingSize != 0)
+    {
+        Sequence sequence = ParseSequence(std::string_view(pending.data(), pendingSize), true);
+
+        pendingSize = 0;
+
+        switch (sequence.action)
+        {
+        case EscapeAction::Replace:
+            sink(std::string_view(&sequence.value, 1));
+            break;
+        case EscapeAction::Stop:
+            stopped = true;
+            return true;
+        default:
+            sink(std::string_view(pending.data(), sequence.length));
+            break;
+        }
+    }
+
+    return false;
+}
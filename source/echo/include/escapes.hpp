@@ -0,0 +1,110 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a custom version of the `echo` command in C++.
+ *  It handles various escape sequences, such as \a (alert), \b (backspace),
+ *  \n (newline), \t (tab), etc. It prints the command-line arguments with the
+ *  escape sequences interpreted correctly.
+ *
+ *  Usage: ./echo <string>
+ *
+ *  The following escape sequences are supported:
+ *      \a      : Alert
+ *      \b      : Backspace
+ *      \c      : Suppress the <newline> that otherwise follows the final argument in the output. All characters following the '\c' in the arguments shall be ignored.
+ *      \f      : Form-feed
+ *      \n      : Newline
+ *      \t      : Tab
+ *      \r      : Carriage return
+ *      \v      : Vertical tab
+ *      \\      : Backslash
+ *      \0num   : 8-bit octal value (num)
+ *
+ *  Note: More details on options and behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/echo.html
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+/**
+ * @brief What the decoder does with the character following a backslash.
+ */
+enum class EscapeAction : std::uint8_t
+{
+    Literal   = 0, // Not an escape sequence, the backslash and the character are written as they are
+    Replace   = 1, // The sequence is replaced by a single byte
+    Octal     = 2, // The sequence is followed by up to three octal digits giving the byte to write
+    Stop      = 3, // Nothing after the sequence is written, not even the trailing newline
+    Backslash = 4  // The backslash is written as it is, the second one may start an escape sequence
+};
+
+/**
+ * @brief Entry of the escape table: the action to take and, for `EscapeAction::Replace`, the byte to write.
+ */
+struct Escape
+{
+    EscapeAction action;
+    char value;
+};
+
+/**
+ * @brief Number of entries in the escape table, one per possible byte.
+ */
+inline constexpr size_t ESCAPE_TABLE_SIZE = std::numeric_limits<unsigned char>::max() + 1;
+
+/**
+ * @brief Builds the escape table from the list of supported escape sequences.
+ *
+ * Every byte not listed maps to `EscapeAction::Literal`.
+ *
+ * @return A table indexed by the character following the backslash.
+ */
+constexpr auto makeEscapeTable() -> std::array<Escape, ESCAPE_TABLE_SIZE>
+{
+    constexpr std::array<std::pair<char, char>, 7> replacements = {{
+        {'a', '\a'},
+        {'b', '\b'},
+        {'f', '\f'},
+        {'n', '\n'},
+        {'r', '\r'},
+        {'t', '\t'},
+        {'v', '\v'},
+    }};
+
+    std::array<Escape, ESCAPE_TABLE_SIZE> table = {};
+
+    for (const auto& [letter, replacement] : replacements)
+    {
+        table.at(static_cast<unsigned char>(letter)) = {EscapeAction::Replace, replacement};
+    }
+
+    table.at('0')  = {EscapeAction::Octal, '\0'};
+    table.at('c')  = {EscapeAction::Stop, '\0'};
+    table.at('\\') = {EscapeAction::Backslash, '\\'};
+
+    return table;
+}
+
+/**
+ * @brief Escape table, generated at compile time.
+ */
+inline constexpr std::array<Escape, ESCAPE_TABLE_SIZE> ESCAPE_TABLE = makeEscapeTable();
+
+/**
+ * @brief Returns how the escape sequence made of a backslash followed by the given character is interpreted.
+ *
+ * @param letter The character following the backslash.
+ * @return The entry of the escape table for this character.
+ */
+constexpr auto getEscape(char letter) -> Escape
+{
+    return ESCAPE_TABLE[static_cast<unsigned char>(letter)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+}
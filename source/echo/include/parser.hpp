@@ -26,10 +26,14 @@
  *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/echo.html
  */
 
-#pragma Once
+#pragma once
 
 #include <cstddef>
+#include <span>
 #include <string>
+#include <string_view>
+
+#include "decoder.hpp"
 
 /**
  * @class Parser
@@ -38,11 +42,10 @@
  * The Parser class provides methods to process strings containing C++-style escape sequences,
  * including both standard escape characters (e.g., `\n`, `\t`) and octal escape sequences (e.g., `\012`).
  *
- * It offers a public interface through `ParseArgument()` that parses and converts all valid escape
- * sequences in a given string into their corresponding ASCII characters.
- *
- * Internally, it uses `ParseEscapeCharacter()` to identify and interpret individual escape codes, and
- * `ParseOctal()` to specifically handle octal escape formats.
+ * The core of the class is `DecodeArgument()`, a single-pass decoder that never allocates: it either
+ * hands the decoded bytes to a caller-provided sink, or writes them into a caller-provided buffer.
+ * Arguments too large to be decoded at once can be fed to a `Decoder` chunk by chunk instead.
+ * `ParseArgument()` is a convenience wrapper returning the decoded argument as a `std::string`.
  *
  * Example usage:
  * @code
@@ -53,73 +56,82 @@
  *
  * @note Octal escapes must begin with `\0` and contain up to three octal digits (0–7).
  *
+ * @see Parser::DecodeArgument
  * @see Parser::ParseArgument
- * @see Parser::ParseEscapeCharacter
- * @see Parser::ParseOctal
+ * @see Decoder
  */
 class Parser
 {
-private:
-    static constexpr int OCTAL   = 8;
-    static constexpr int MAXSIZE = 5;
-
+public:
     /**
-     * @brief Converts an octal escape sequence from the input string into its corresponding ASCII character.
-     *
-     * This method expects an input string starting with an octal escape sequence (e.g., `\012`).
-     * It removes the first two characters (assumed to be the prefix \0`), then parses the remaining
-     * digits as an octal number and converts it to the corresponding ASCII character.
-     *
-     * @param argument A string starting with a prefix followed by octal digits (e.g., "\012").
-     * @return A string containing the single character represented by the octal value.
+     * @brief Outcome of decoding an argument into a caller-provided buffer.
      */
-    auto static ParseOctal(const std::string&, size_t) -> std::string;
+    struct DecodeResult
+    {
+        size_t size; // Number of bytes written to the output buffer
+        bool stop;   // True if a `\c` sequence was met: nothing else shall be printed
+    };
+
+    Parser();
 
     /**
-     * @brief Parses a single escape sequence in the input string and returns its corresponding character.
+     * @brief Decodes an argument in a single pass and hands the result to a sink.
      *
-     * This method examines the character at the next index of the input string
-     * and attempts to interpret it as a valid escape sequence. If the character is recognized
-     * as a standard C++ escape code (e.g., `\n`, `\t`, `\0`), it is translated into the corresponding
-     * character. Octal sequences starting with `\0` are delegated to the `ParseOctal` method.
+     * The argument is scanned once by a `Decoder`, using `Scanner` to jump from one backslash to the next.
+     * Runs of characters that need no interpretation are passed to the sink as views into the argument
+     * itself, and every interpreted escape sequence is passed as a one-byte view. No memory is allocated.
      *
-     * Supported escape sequences:
-     * - `\a` : Alert (bell)
-     * - `\b` : Backspace
-     * - `\f` : Form feed
-     * - `\n` : Newline
-     * - `\r` : Carriage return
-     * - `\t` : Horizontal tab
-     * - `\v` : Vertical tab
-     * - `\\` : Backslash
-     * - `\0nnn` : Octal escape (handled via `ParseOctal`)
+     * The sink is any callable accepting a `std::string_view`. The view is only valid for the duration of
+     * the call, so the sink must copy the bytes it wants to keep.
      *
-     * If the character following the backslash is not recognized, the method returns an empty string.
+     * @param argument The input string that may include escape sequences.
+     * @param sink The callable receiving the decoded bytes, in order.
+     * @return True if a `\c` sequence was met, meaning the rest of the argument and any output that
+     *         would follow it (including the trailing newline) shall be suppressed.
+     */
+    template <typename Sink>
+    static auto DecodeArgument(std::string_view, Sink&&) -> bool;
+
+    /**
+     * @brief Decodes an argument in a single pass into a caller-provided buffer.
      *
-     * @param argument The input string that may contain an escape sequence.
-     * @return A string containing the corresponding interpreted character, or an empty string if unrecognized.
+     * A decoded argument is never longer than its input, so a buffer of `argument.size()` bytes is
+     * always large enough. The same buffer can be reused from one argument to the next.
      *
-     * @see Parser::ParseOctal
+     * @param argument The input string that may include escape sequences.
+     * @param output The buffer receiving the decoded bytes. Must hold at least `argument.size()` bytes.
+     * @return The number of bytes written and whether a `\c` sequence was met.
      */
-    auto static ParseEscapeCharacter(const std::string&, size_t) -> std::string;
-
-public:
-    Parser();
+    static auto DecodeArgument(std::string_view, std::span<char>) -> DecodeResult;
 
     /**
      * @brief Parses an input string containing escape sequences and returns the interpreted result.
      *
-     * This method processes the input string character by character. When a backslash (`\\`) is encountered,
-     * it attempts to parse the following characters as an escape sequence using `ParseEscapeCharacter()`.
-     * Otherwise, the character is appended directly to the output string.
-     *
-     * The method supports both standard escape sequences (e.g., newline, tab) and octal escape sequences
-     * starting with `\0`.
+     * This is a thin wrapper around `DecodeArgument()` building a `std::string` from the decoded bytes.
      *
      * @param argument The input string that may include escape sequences.
      * @return A string where all valid escape sequences are interpreted and replaced by their actual characters.
      *
-     * @see Parser::ParseEscapeCharacter
+     * @see Parser::DecodeArgument
      */
-    auto static ParseArgument(const std::string&) -> std::string;
+    static auto ParseArgument(const std::string&) -> std::string;
 };
+
+template <typename Sink>
+auto Parser::DecodeArgument(std::string_view argument, Sink&& sink) -> bool
+{
+    Decoder decoder; // Decodes the whole argument as a single chunk
+
+    // An argument ending with a backslash is written as it is, without interpreting any escape sequence
+    if (argument.empty() || argument.back() == '\\')
+    {
+        if (!argument.empty())
+        {
+            sink(argument);
+        }
+
+        return false;
+    }
+
+    return decoder.Feed(argument, sink) || decoder.Finish(sink);
+}
@@ -0,0 +1,86 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a custom version of the `echo` command in C++.
+ *  It handles various escape sequences, such as \a (alert), \b (backspace),
+ *  \n (newline), \t (tab), etc. It prints the command-line arguments with the
+ *  escape sequences interpreted correctly.
+ *
+ *  Usage: ./echo <string>
+ *
+ *  The following escape sequences are supported:
+ *      \a      : Alert
+ *      \b      : Backspace
+ *      \c      : Suppress the <newline> that otherwise follows the final argument in the output. All characters following the '\c' in the arguments shall be ignored.
+ *      \f      : Form-feed
+ *      \n      : Newline
+ *      \t      : Tab
+ *      \r      : Carriage return
+ *      \v      : Vertical tab
+ *      \\      : Backslash
+ *      \0num   : 8-bit octal value (num)
+ *
+ *  Note: More details on options and behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/echo.html
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @class Scanner
+ * @brief Locates the backslashes starting escape sequences in an argument.
+ *
+ * Most arguments contain few escape sequences, if any. Instead of looking at every character, the
+ * decoder asks the Scanner for the next backslash and copies everything before it in one go.
+ *
+ * Several implementations are provided: a scalar one, and on x86 an SSE2 one comparing 16 bytes at
+ * a time and an AVX2 one comparing 32 bytes at a time. `FindBackslash()` uses the widest one the CPU
+ * supports, selected once at runtime.
+ *
+ * Example usage:
+ * @code
+ * size_t position = Scanner::FindBackslash("Hello\\nWorld", 0);
+ * position == 5
+ * @endcode
+ */
+class Scanner
+{
+public:
+    /**
+     * @brief Returns the position of the first backslash at or after the given position.
+     *
+     * @param text The string to search.
+     * @param position The index where the search starts.
+     * @return The index of the backslash, or `text.size()` if there is none.
+     */
+    static auto FindBackslash(std::string_view, size_t) -> size_t;
+
+    /**
+     * @brief Portable implementation of `FindBackslash()`, looking at one character at a time.
+     */
+    static auto FindBackslashScalar(std::string_view, size_t) -> size_t;
+
+#if defined(__x86_64__) || defined(__i386__)
+    /**
+     * @brief SSE2 implementation of `FindBackslash()`, looking at 16 characters at a time.
+     */
+    static auto FindBackslashSse2(std::string_view, size_t) -> size_t;
+
+    /**
+     * @brief AVX2 implementation of `FindBackslash()`, looking at 32 characters at a time.
+     *
+     * @note Must only be called if the CPU supports AVX2.
+     */
+    static auto FindBackslashAvx2(std::string_view, size_t) -> size_t;
+#endif
+
+    /**
+     * @brief Returns the name of the implementation used by `FindBackslash()` ("avx2", "sse2" or "scalar").
+     */
+    static auto Implementation() -> std::string_view;
+};
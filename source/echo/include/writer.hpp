@@ -0,0 +1,119 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a custom version of the `echo` command in C++.
+ *  It handles various escape sequences, such as \a (alert), \b (backspace),
+ *  \n (newline), \t (tab), etc. It prints the command-line arguments with the
+ *  escape sequences interpreted correctly.
+ *
+ *  Usage: ./echo <string>
+ *
+ *  The following escape sequences are supported:
+ *      \a      : Alert
+ *      \b      : Backspace
+ *      \c      : Suppress the <newline> that otherwise follows the final argument in the output. All characters following the '\c' in the arguments shall be ignored.
+ *      \f      : Form-feed
+ *      \n      : Newline
+ *      \t      : Tab
+ *      \r      : Carriage return
+ *      \v      : Vertical tab
+ *      \\      : Backslash
+ *      \0num   : 8-bit octal value (num)
+ *
+ *  Note: More details on options and behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/echo.html
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <sys/uio.h>
+
+/**
+ * @class Writer
+ * @brief Writes gathered output to a file descriptor with as few system calls as possible.
+ *
+ * The output is described as an array of `iovec` segments pointing to the bytes to write, and handed to
+ * `writev` in one call. Short writes and interruptions by a signal are resumed where they stopped.
+ *
+ * A pipe receives a single `writev` of at most `PIPE_BUF` bytes atomically, so a short line written
+ * with `WriteVector()` reaches the reader in one piece.
+ */
+class Writer
+{
+public:
+    /**
+     * @brief Writes all the segments to the file descriptor.
+     *
+     * All the segments are written with a single `writev`, unless there are more than `IOV_MAX` of them
+     * or the system call writes less than requested, in which case it is called again for what remains.
+     *
+     * @param descriptor The file descriptor to write to.
+     * @param segments The segments to write, in order. They are updated as the bytes are written.
+     * @return True if everything was written, false if an error occurred (errno is set accordingly).
+     */
+    static auto WriteVector(int, std::span<iovec>) -> bool;
+
+    /**
+     * @brief Writes a string to the file descriptor.
+     *
+     * @param descriptor The file descriptor to write to.
+     * @param text The bytes to write.
+     * @return True if everything was written, false if an error occurred (errno is set accordingly).
+     */
+    static auto Write(int, std::string_view) -> bool;
+};
+
+/**
+ * @class ChunkWriter
+ * @brief Collects output in a fixed-size buffer and writes it each time the buffer is full.
+ *
+ * The ChunkWriter is a sink for `Decoder` and `Parser::DecodeArgument()`: it accepts `std::string_view`
+ * pieces and copies them into its buffer. Pieces larger than the buffer are written directly, so memory
+ * usage is bounded by the buffer size whatever the size of the output.
+ *
+ * Example usage:
+ * @code
+ * ChunkWriter output(STDOUT_FILENO, 65536);
+ * output("Hello ");
+ * output("World\n");
+ * output.Flush();
+ * @endcode
+ */
+class ChunkWriter
+{
+private:
+    int descriptor;           // File descriptor the output is written to
+    std::vector<char> buffer; // Output waiting to be written
+    size_t used = 0;          // Bytes of the buffer holding output
+    bool failed = false;      // Set once a write has failed, nothing is written after that
+
+public:
+    /**
+     * @brief Constructs a ChunkWriter and allocates its buffer.
+     *
+     * @param descriptor The file descriptor to write to.
+     * @param capacity The size of the buffer, in bytes.
+     */
+    ChunkWriter(int, size_t);
+
+    /**
+     * @brief Appends bytes to the output, writing the buffer first if they don't fit in it.
+     *
+     * @param piece The bytes to append.
+     */
+    void operator()(std::string_view);
+
+    /**
+     * @brief Writes the content of the buffer.
+     *
+     * @return True if all the output so far has been written, false if a write has failed.
+     */
+    auto Flush() -> bool;
+};
@@ -0,0 +1,125 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a custom version of the `echo` command in C++.
+ *  It handles various escape sequences, such as \a (alert), \b (backspace),
+ *  \n (newline), \t (tab), etc. It prints the command-line arguments with the
+ *  escape sequences interpreted correctly.
+ *
+ *  Usage: ./echo <string>
+ *
+ *  The following escape sequences are supported:
+ *      \a      : Alert
+ *      \b      : Backspace
+ *      \c      : Suppress the <newline> that otherwise follows the final argument in the output. All characters following the '\c' in the arguments shall be ignored.
+ *      \f      : Form-feed
+ *      \n      : Newline
+ *      \t      : Tab
+ *      \r      : Carriage return
+ *      \v      : Vertical tab
+ *      \\      : Backslash
+ *      \0num   : 8-bit octal value (num)
+ *
+ *  Note: More details on options and behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/echo.html
+ */
+
+#include <cstddef>
+#include <string_view>
+
+#include "decoder.hpp"
+#include "escapes.hpp"
+
+using std::string_view;
+
+namespace
+{
+// Counts the bytes that start an escape sequence, so that no entry of the table can be added by mistake
+constexpr auto countEscapes() -> size_t
+{
+    size_t count = 0;
+
+    for (const Escape& escape : ESCAPE_TABLE)
+    {
+        if (escape.action != EscapeAction::Literal)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Checks the escape table against the sequences supported by echo
+static_assert(getEscape('a').action == EscapeAction::Replace && getEscape('a').value == '\a', "\\a is an alert");
+static_assert(getEscape('b').action == EscapeAction::Replace && getEscape('b').value == '\b', "\\b is a backspace");
+static_assert(getEscape('f').action == EscapeAction::Replace && getEscape('f').value == '\f', "\\f is a form feed");
+static_assert(getEscape('n').action == EscapeAction::Replace && getEscape('n').value == '\n', "\\n is a newline");
+static_assert(getEscape('r').action == EscapeAction::Replace && getEscape('r').value == '\r', "\\r is a carriage return");
+static_assert(getEscape('t').action == EscapeAction::Replace && getEscape('t').value == '\t', "\\t is a tab");
+static_assert(getEscape('v').action == EscapeAction::Replace && getEscape('v').value == '\v', "\\v is a vertical tab");
+static_assert(getEscape('c').action == EscapeAction::Stop, "\\c suppresses the rest of the output");
+static_assert(getEscape('0').action == EscapeAction::Octal, "\\0num is an octal value");
+static_assert(getEscape('\\').action == EscapeAction::Backslash, "\\\\ writes a backslash");
+static_assert(getEscape('x').action == EscapeAction::Literal && getEscape('s').action == EscapeAction::Literal, "Unknown sequences are written as they are");
+static_assert(getEscape('1').action == EscapeAction::Literal, "Octal values must start with \\0");
+static_assert(getEscape(static_cast<char>(0xFF)).action == EscapeAction::Literal, "Bytes above 0x7F are never escape sequences");
+static_assert(countEscapes() == 10, "Only the sequences listed above are escape sequences");
+} // namespace
+
+auto Decoder::ParseSequence(string_view text, bool final) -> Sequence
+{
+    int decimal   = 0; // Decimal value converted from octal
+    size_t digits = 0; // Number of octal digits consumed
+
+    // A lone backslash at the very end is written as it is
+    if (text.size() < 2)
+    {
+        return {EscapeAction::Literal, '\0', final ? text.size() : 0};
+    }
+
+    Escape escape = getEscape(text[1]);
+
+    switch (escape.action)
+    {
+    case EscapeAction::Replace:
+    case EscapeAction::Stop:
+    case EscapeAction::Literal:
+        return {escape.action, escape.value, 2};
+    case EscapeAction::Backslash:
+        return {EscapeAction::Backslash, '\\', 1}; // Only the first backslash is consumed, the second may start a sequence
+    case EscapeAction::Octal:
+    default:
+        break;
+    }
+
+    // Accumulates up to three octal digits, stopping at the first character that isn't one
+    while (digits < OCTAL_DIGITS && 2 + digits < text.size())
+    {
+        char character = text[2 + digits];
+
+        if (character < '0' || character >= '0' + OCTAL)
+        {
+            break;
+        }
+
+        decimal = decimal * OCTAL + (character - '0');
+        digits++;
+    }
+
+    // The text ended before the sequence did, the next chunk may hold more digits
+    if (!final && digits < OCTAL_DIGITS && 2 + digits == text.size())
+    {
+        return {EscapeAction::Octal, '\0', 0};
+    }
+
+    // Without any octal digit, \0 is written as it is
+    if (digits == 0)
+    {
+        return {EscapeAction::Literal, '\0', 2};
+    }
+
+    return {EscapeAction::Replace, static_cast<char>(decimal), 2 + digits};
+}
@@ -26,44 +26,145 @@
  *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/echo.html
  */
 
+#include <cstddef>
 #include <cstdlib>
-#include <cstring>
-#include <iostream>
-#include <string>
+#include <span>
+#include <string_view>
 #include <vector>
 
+#include <sys/uio.h>
 #include <unistd.h>
 
+#include "decoder.hpp"
 #include "parser.hpp"
+#include "scanner.hpp"
+#include "writer.hpp"
 
-using std::cerr;
-using std::cout;
-using std::string;
+using std::span;
+using std::string_view;
 using std::vector;
 
+namespace
+{
+constexpr size_t CHUNK_SIZE = 64 * 1024; // Above this size, the line is decoded and written one chunk at a time
+
+// Decodes and writes the arguments one chunk at a time, so memory usage doesn't depend on the size of the arguments
+auto StreamArguments(span<char*> arguments) -> bool
+{
+    ChunkWriter output(STDOUT_FILENO, CHUNK_SIZE); // Receives the decoded chunks
+    Decoder decoder;                               // Carries escape sequences cut at the end of a chunk over to the next one
+
+    for (size_t i = 0; i < arguments.size(); i++)
+    {
+        string_view argument = arguments[i];
+
+        if (i != 0)
+        {
+            output(" ");
+        }
+
+        // An argument ending with a backslash is written as it is, without interpreting any escape sequence
+        if (!argument.empty() && argument.back() == '\\')
+        {
+            output(argument);
+            continue;
+        }
+
+        for (size_t position = 0; position < argument.size(); position += CHUNK_SIZE)
+        {
+            if (decoder.Feed(argument.substr(position, CHUNK_SIZE), output))
+            {
+                return output.Flush();
+            }
+
+            // Each chunk is written as soon as it is decoded
+            if (!output.Flush())
+            {
+                return false;
+            }
+        }
+
+        if (decoder.Finish(output))
+        {
+            return output.Flush();
+        }
+    }
+
+    output("\n");
+
+    return output.Flush();
+}
+} // namespace
+
 auto main(int argc, char* argv[]) -> int
 {
-    vector<string> arguments(argv + 1, argv + argc); // Vector of arguments from command-line inputs
+    span<char*> arguments(argv + 1, argc > 1 ? argc - 1 : 0); // Arguments from command-line inputs, program name excluded
+    size_t totalSize = 0;                                      // Size of all the arguments together
+    size_t used      = 0;                                      // Bytes of the decoding buffer already used
+    bool stop        = false;                                  // Set when a \c sequence suppresses the rest of the output
+    char separator   = ' ';                                    // Written between two arguments
+    char newline     = '\n';                                   // Written after the last argument
 
     // Check if no arguments are provided (argc <= 1 means no input string)
     if (argc <= 1)
     {
-        cerr << "Usage: ./echo <string>\n";
+        Writer::Write(STDERR_FILENO, "Usage: ./echo <string>\n");
         return EXIT_FAILURE;
     }
 
-    // Output the strings (arguments) passed after the options
-    for (const string& argument : arguments)
+    for (string_view argument : arguments)
+    {
+        totalSize += argument.size();
+    }
+
+    // Large lines can't be written atomically anyway, so they are streamed instead of being decoded whole in memory
+    if (totalSize > CHUNK_SIZE)
     {
-        cout << Parser::ParseArgument(argument);
+        return StreamArguments(arguments) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    vector<char> decoded(totalSize);        // Holds the decoded arguments, a decoded argument is never longer than its input
+    vector<iovec> segments;                 // Pieces of the line, written all at once
+    segments.reserve(2 * arguments.size()); // One segment per argument and one per separator or newline
+
+    // Gather the strings (arguments) passed after the options
+    for (size_t i = 0; i < arguments.size(); i++)
+    {
+        string_view argument = arguments[i];
+
+        if (i != 0)
+        {
+            segments.push_back({&separator, 1});
+        }
 
-        if (argument == arguments.back())
+        // Without any backslash there is nothing to decode, the argument is written straight from argv
+        if (Scanner::FindBackslash(argument, 0) == argument.size())
         {
-            cout << " ";
+            segments.push_back({arguments[i], argument.size()});
+            continue;
+        }
+
+        Parser::DecodeResult result = Parser::DecodeArgument(argument, span<char>(decoded).subspan(used));
+
+        segments.push_back({decoded.data() + used, result.size});
+        used += result.size;
+
+        if (result.stop)
+        {
+            stop = true;
+            break;
         }
     }
 
-    cout << "\n";
+    if (!stop)
+    {
+        segments.push_back({&newline, 1});
+    }
+
+    if (!Writer::WriteVector(STDOUT_FILENO, segments))
+    {
+        return EXIT_FAILURE;
+    }
 
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,137 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a custom version of the `echo` command in C++.
+ *  It handles various escape sequences, such as \a (alert), \b (backspace),
+ *  \n (newline), \t (tab), etc. It prints the command-line arguments with the
+ *  escape sequences interpreted correctly.
+ *
+ *  Usage: ./echo <string>
+ *
+ *  The following escape sequences are supported:
+ *      \a      : Alert
+ *      \b      : Backspace
+ *      \c      : Suppress the <newline> that otherwise follows the final argument in the output. All characters following the '\c' in the arguments shall be ignored.
+ *      \f      : Form-feed
+ *      \n      : Newline
+ *      \t      : Tab
+ *      \r      : Carriage return
+ *      \v      : Vertical tab
+ *      \\      : Backslash
+ *      \0num   : 8-bit octal value (num)
+ *
+ *  Note: More details on options and behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/echo.html
+ */
+
+#include <bit>
+#include <cstddef>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include "scanner.hpp"
+
+using std::countr_zero;
+using std::string_view;
+
+namespace
+{
+using FindFunction = auto (*)(string_view, size_t) -> size_t;
+
+struct Dispatch
+{
+    FindFunction find;
+    string_view name;
+};
+
+// Picks the widest implementation supported by the CPU the program runs on
+auto SelectImplementation() -> Dispatch
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return {Scanner::FindBackslashAvx2, "avx2"};
+    }
+
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return {Scanner::FindBackslashSse2, "sse2"};
+    }
+#endif
+
+    return {Scanner::FindBackslashScalar, "scalar"};
+}
+
+const Dispatch dispatch = SelectImplementation(); // Implementation selected when the program starts
+} // namespace
+
+auto Scanner::FindBackslash(string_view text, size_t position) -> size_t
+{
+    return dispatch.find(text, position);
+}
+
+auto Scanner::Implementation() -> string_view
+{
+    return dispatch.name;
+}
+
+auto Scanner::FindBackslashScalar(string_view text, size_t position) -> size_t
+{
+    while (position < text.size() && text[position] != '\\')
+    {
+        position++;
+    }
+
+    return position;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("sse2"))) auto Scanner::FindBackslashSse2(string_view text, size_t position) -> size_t
+{
+    constexpr size_t STRIDE = 16;
+    const __m128i backslashes = _mm_set1_epi8('\\');
+
+    // Compares 16 characters at a time, the mask having one bit set per backslash found
+    for (; position + STRIDE <= text.size(); position += STRIDE)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + position)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto mask     = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, backslashes)));
+
+        if (mask != 0)
+        {
+            return position + countr_zero(mask);
+        }
+    }
+
+    return FindBackslashScalar(text, position);
+}
+
+__attribute__((target("avx2"))) auto Scanner::FindBackslashAvx2(string_view text, size_t position) -> size_t
+{
+    constexpr size_t STRIDE = 32;
+    const __m256i backslashes = _mm256_set1_epi8('\\');
+
+    // Compares 32 characters at a time, the mask having one bit set per backslash found
+    for (; position + STRIDE <= text.size(); position += STRIDE)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + position)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto mask     = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, backslashes)));
+
+        if (mask != 0)
+        {
+            return position + countr_zero(mask);
+        }
+    }
+
+    // Less than 32 characters left, the SSE2 implementation handles at most one more stride. The upper halves
+    // of the AVX registers are cleared first, otherwise mixing AVX and SSE instructions stalls the CPU
+    _mm256_zeroupper();
+
+    return FindBackslashSse2(text, position);
+}
+#endif
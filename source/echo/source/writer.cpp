@@ -0,0 +1,128 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ *  Description:
+ *  This application implements a custom version of the `echo` command in C++.
+ *  It handles various escape sequences, such as \a (alert), \b (backspace),
+ *  \n (newline), \t (tab), etc. It prints the command-line arguments with the
+ *  escape sequences interpreted correctly.
+ *
+ *  Usage: ./echo <string>
+ *
+ *  The following escape sequences are supported:
+ *      \a      : Alert
+ *      \b      : Backspace
+ *      \c      : Suppress the <newline> that otherwise follows the final argument in the output. All characters following the '\c' in the arguments shall be ignored.
+ *      \f      : Form-feed
+ *      \n      : Newline
+ *      \t      : Tab
+ *      \r      : Carriage return
+ *      \v      : Vertical tab
+ *      \\      : Backslash
+ *      \0num   : 8-bit octal value (num)
+ *
+ *  Note: More details on options and behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/echo.html
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <sys/uio.h>
+
+#include "writer.hpp"
+
+using std::copy;
+using std::min;
+using std::span;
+using std::string_view;
+
+namespace
+{
+#ifdef IOV_MAX
+constexpr size_t MAX_SEGMENTS = IOV_MAX;
+#else
+constexpr size_t MAX_SEGMENTS = 1024; // Lowest limit among the systems not defining IOV_MAX
+#endif
+} // namespace
+
+auto Writer::WriteVector(int descriptor, span<iovec> segments) -> bool
+{
+    while (!segments.empty())
+    {
+        ssize_t written = writev(descriptor, segments.data(), static_cast<int>(min(segments.size(), MAX_SEGMENTS)));
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return false;
+        }
+
+        auto remaining = static_cast<size_t>(written); // Bytes written that haven't been removed from the segments yet
+
+        // Drops the segments that have been written completely
+        while (!segments.empty() && remaining >= segments.front().iov_len)
+        {
+            remaining -= segments.front().iov_len;
+            segments = segments.subspan(1);
+        }
+
+        // Moves the start of a segment that has been written partially
+        if (remaining > 0)
+        {
+            segments.front().iov_base = static_cast<char*>(segments.front().iov_base) + remaining;
+            segments.front().iov_len -= remaining;
+        }
+    }
+
+    return true;
+}
+
+auto Writer::Write(int descriptor, string_view text) -> bool
+{
+    iovec segment = {const_cast<char*>(text.data()), text.size()}; // NOLINT(cppcoreguidelines-pro-type-const-cast)
+
+    return WriteVector(descriptor, span<iovec>(&segment, 1));
+}
+
+ChunkWriter::ChunkWriter(int descriptor, size_t capacity) : descriptor(descriptor), buffer(capacity) {}
+
+void ChunkWriter::operator()(string_view piece)
+{
+    if (used + piece.size() > buffer.size())
+    {
+        Flush();
+
+        // Too large for the buffer, the piece is written without being copied
+        if (piece.size() > buffer.size())
+        {
+            failed = failed || !Writer::Write(descriptor, piece);
+            return;
+        }
+    }
+
+    copy(piece.begin(), piece.end(), buffer.begin() + static_cast<std::ptrdiff_t>(used));
+    used += piece.size();
+}
+
+auto ChunkWriter::Flush() -> bool
+{
+    if (used != 0 && !failed)
+    {
+        failed = !Writer::Write(descriptor, string_view(buffer.data(), used));
+    }
+
+    used = 0;
+
+    return !failed;
+}
@@ -0,0 +1,250 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+
+#include "decoder.hpp"
+#include "parser.hpp"
+#include "scanner.hpp"
+
+using std::span;
+using std::string;
+using std::string_view;
+
+namespace
+{
+constexpr size_t SCAN_SIZE  = 64 * 1024;        // Size of the arguments given to the scanners
+constexpr size_t MIN_SIZE   = 16;               // Smallest argument given to the parser
+constexpr size_t MAX_SIZE   = 16 * 1024 * 1024; // Largest argument given to the parser
+constexpr size_t CHUNK_SIZE = 64 * 1024;        // Chunk size used by echo when streaming
+
+std::atomic<int64_t> allocations = 0; // Number of calls to operator new since the program started
+
+// Builds an argument of the given size where roughly `density` percent of the characters start the given escape sequence
+auto MakeArgument(size_t size, int64_t density, string_view sequence = "\\n") -> string
+{
+    string argument;
+    uint32_t seed = 1;
+
+    argument.reserve(size + sequence.size());
+
+    while (argument.size() < size)
+    {
+        seed = seed * 1664525U + 1013904223U; // Linear congruential generator, so inputs are identical between runs
+
+        if (static_cast<int64_t>((seed >> 8U) % 100U) < density)
+        {
+            argument += sequence;
+        }
+        else
+        {
+            argument += static_cast<char>('a' + (seed >> 8U) % 26U);
+        }
+    }
+
+    argument.resize(size);
+
+    if (argument.back() == '\\')
+    {
+        argument.back() = 'z';
+    }
+
+    return argument;
+}
+
+// Runs the benchmarked call, adding the number of allocations it made to `counted`
+template <typename Call>
+void CountAllocations(int64_t& counted, Call call)
+{
+    int64_t before = allocations.load(std::memory_order_relaxed);
+
+    call();
+
+    counted += allocations.load(std::memory_order_relaxed) - before;
+}
+
+// Reports the throughput and the number of allocations per iteration
+void ReportCounters(benchmark::State& state, size_t bytes, int64_t counted)
+{
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+    state.counters["allocs_per_call"] = benchmark::Counter(static_cast<double>(counted), benchmark::Counter::kAvgIterations);
+}
+
+template <typename Find>
+void ScanArgument(benchmark::State& state, Find find)
+{
+    string argument = MakeArgument(SCAN_SIZE, state.range(0));
+    size_t found    = 0;
+
+    for (auto _ : state)
+    {
+        for (size_t i = find(argument, 0); i < argument.size(); i = find(argument, i + 1))
+        {
+            found++;
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * argument.size()));
+}
+
+void BM_ScanScalar(benchmark::State& state)
+{
+    ScanArgument(state, Scanner::FindBackslashScalar);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+void BM_ScanSse2(benchmark::State& state)
+{
+    ScanArgument(state, Scanner::FindBackslashSse2);
+}
+
+void BM_ScanAvx2(benchmark::State& state)
+{
+    if (!__builtin_cpu_supports("avx2"))
+    {
+        state.SkipWithError("AVX2 is not supported by this CPU");
+        return;
+    }
+
+    ScanArgument(state, Scanner::FindBackslashAvx2);
+}
+#endif
+
+// ParseArgument, returning a std::string: one allocation per call is expected, for the result
+void BM_ParseArgument(benchmark::State& state)
+{
+    string argument = MakeArgument(static_cast<size_t>(state.range(0)), state.range(1));
+    int64_t counted = 0;
+
+    for (auto _ : state)
+    {
+        CountAllocations(counted, [&argument]
+                         { benchmark::DoNotOptimize(Parser::ParseArgument(argument)); });
+    }
+
+    ReportCounters(state, argument.size(), counted);
+}
+
+// DecodeArgument into a reused buffer: no allocation is expected
+void BM_DecodeArgument(benchmark::State& state)
+{
+    string argument = MakeArgument(static_cast<size_t>(state.range(0)), state.range(1));
+    string output(argument.size(), '\0');
+    int64_t counted = 0;
+
+    for (auto _ : state)
+    {
+        CountAllocations(counted, [&argument, &output]
+                         { benchmark::DoNotOptimize(Parser::DecodeArgument(argument, span<char>(output))); });
+        benchmark::ClobberMemory();
+    }
+
+    ReportCounters(state, argument.size(), counted);
+    state.SetLabel(string(Scanner::Implementation()));
+}
+
+// Decoder fed in chunks, as echo does for large lines
+void BM_DecodeChunks(benchmark::State& state)
+{
+    string argument = MakeArgument(static_cast<size_t>(state.range(0)), state.range(1));
+    size_t written  = 0;
+    auto sink       = [&written](string_view piece)
+    { written += piece.size(); };
+    int64_t counted = 0;
+
+    for (auto _ : state)
+    {
+        CountAllocations(counted, [&argument, &sink]
+                         {
+                             Decoder decoder;
+
+                             for (size_t position = 0; position < argument.size(); position += CHUNK_SIZE)
+                             {
+                                 decoder.Feed(string_view(argument).substr(position, CHUNK_SIZE), sink);
+                             }
+
+                             decoder.Finish(sink); });
+        benchmark::DoNotOptimize(written);
+    }
+
+    ReportCounters(state, argument.size(), counted);
+}
+
+// Arguments made mostly of octal sequences, the slowest sequences to decode
+void BM_ParseArgumentOctal(benchmark::State& state)
+{
+    string argument = MakeArgument(static_cast<size_t>(state.range(0)), state.range(1), "\\0101");
+    int64_t counted = 0;
+
+    for (auto _ : state)
+    {
+        CountAllocations(counted, [&argument]
+                         { benchmark::DoNotOptimize(Parser::ParseArgument(argument)); });
+    }
+
+    ReportCounters(state, argument.size(), counted);
+}
+
+// Arguments starting with \c: the cost must not depend on what follows
+void BM_ParseArgumentStop(benchmark::State& state)
+{
+    string argument = "\\c" + MakeArgument(static_cast<size_t>(state.range(0)), state.range(1));
+    int64_t counted = 0;
+
+    for (auto _ : state)
+    {
+        CountAllocations(counted, [&argument]
+                         { benchmark::DoNotOptimize(Parser::ParseArgument(argument)); });
+    }
+
+    ReportCounters(state, argument.size(), counted);
+}
+} // namespace
+
+// Counts the allocations made by the benchmarked code. None of the replacements is inlined, so the compiler
+// doesn't mistake the pairing of operator new and operator delete with malloc() and free() for a mismatch
+__attribute__((noinline)) auto operator new(size_t size) -> void*
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* pointer = std::malloc(size)) // NOLINT(cppcoreguidelines-no-malloc)
+    {
+        return pointer;
+    }
+
+    throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void* pointer) noexcept
+{
+    std::free(pointer); // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+__attribute__((noinline)) void operator delete(void* pointer, size_t /*size*/) noexcept
+{
+    std::free(pointer); // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+// Escape densities, in percent of the characters of the argument
+BENCHMARK(BM_ScanScalar)->Arg(0)->Arg(1)->Arg(20);
+#if defined(__x86_64__) || defined(__i386__)
+BENCHMARK(BM_ScanSse2)->Arg(0)->Arg(1)->Arg(20);
+BENCHMARK(BM_ScanAvx2)->Arg(0)->Arg(1)->Arg(20);
+#endif
+
+// Argument sizes from 16 B to 16 MB, by steps of 16, combined with escape densities in percent
+BENCHMARK(BM_ParseArgument)->ArgsProduct({benchmark::CreateRange(MIN_SIZE, MAX_SIZE, 16), {0, 1, 20}});
+BENCHMARK(BM_DecodeArgument)->ArgsProduct({benchmark::CreateRange(MIN_SIZE, MAX_SIZE, 16), {0, 1, 20}});
+BENCHMARK(BM_DecodeChunks)->ArgsProduct({{1024 * 1024, MAX_SIZE}, {0, 20}});
+BENCHMARK(BM_ParseArgumentOctal)->ArgsProduct({benchmark::CreateRange(MIN_SIZE, MAX_SIZE, 16), {50, 100}});
+BENCHMARK(BM_ParseArgumentStop)->ArgsProduct({{MIN_SIZE, MAX_SIZE}, {0}});
+
+BENCHMARK_MAIN();
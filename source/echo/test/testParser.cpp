@@ -1,7 +1,17 @@
+#include <array>
 #include <gtest/gtest.h>
+#include <span>
 #include <string>
+#include <string_view>
+#include <thread>
 
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "decoder.hpp"
 #include "parser.hpp"
+#include "scanner.hpp"
+#include "writer.hpp"
 
 using std::string;
 
@@ -87,3 +97,136 @@ TEST(ParserTests, MixedEscapeSequences)
 {
     EXPECT_EQ(Parser::ParseArgument("Mix\\a\\b\\t\\nEnd"), string("Mix") + '\a' + '\b' + '\t' + '\n' + "End");
 }
+
+TEST(ParserTests, OctalEscapeDigits)
+{
+    EXPECT_EQ(Parser::ParseArgument("\\0101"), "A");
+    EXPECT_EQ(Parser::ParseArgument("\\01012"), "A2");
+    EXPECT_EQ(Parser::ParseArgument("Null\\00End"), string("Null") + '\0' + "End");
+}
+
+TEST(ParserTests, DecodeIntoBuffer)
+{
+    string argument = "Tab\\tEnd\\c Ignored";
+    string buffer(argument.size(), ' ');
+
+    Parser::DecodeResult result = Parser::DecodeArgument(argument, std::span<char>(buffer));
+
+    EXPECT_TRUE(result.stop);
+    EXPECT_EQ(buffer.substr(0, result.size), "Tab\tEnd");
+}
+
+TEST(ParserTests, DecodeIntoSink)
+{
+    string decoded;
+    size_t calls = 0;
+
+    bool stop = Parser::DecodeArgument("Hello\\nWorld\\041", [&](std::string_view piece)
+                                       {
+                                           decoded += piece;
+                                           calls++; });
+
+    EXPECT_FALSE(stop);
+    EXPECT_EQ(decoded, "Hello\nWorld!");
+    EXPECT_EQ(calls, 4);
+}
+
+TEST(ScannerTests, FindsBackslashAtEveryPosition)
+{
+    // Covers positions inside the vectorized strides as well as in the scalar tail
+    for (size_t size = 0; size < 80; size++)
+    {
+        for (size_t backslash = 0; backslash <= size; backslash++)
+        {
+            string text(size, 'x');
+
+            if (backslash < size)
+            {
+                text.at(backslash) = '\\';
+            }
+
+            for (size_t start = 0; start <= size; start++)
+            {
+                size_t expected = start <= backslash ? backslash : size;
+
+                EXPECT_EQ(Scanner::FindBackslash(text, start), expected);
+                EXPECT_EQ(Scanner::FindBackslashScalar(text, start), expected);
+#if defined(__x86_64__) || defined(__i386__)
+                EXPECT_EQ(Scanner::FindBackslashSse2(text, start), expected);
+                if (__builtin_cpu_supports("avx2"))
+                {
+                    EXPECT_EQ(Scanner::FindBackslashAvx2(text, start), expected);
+                }
+#endif
+            }
+        }
+    }
+}
+
+TEST(WriterTests, ResumesShortWrites)
+{
+    std::array<int, 2> pipeEnds = {};
+    string first(300000, 'a'); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    string second = " ";
+    string third(200000, 'b'); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    string received;
+
+    ASSERT_EQ(pipe(pipeEnds.data()), 0);
+
+    // The pipe holds less than what is written, so writev returns early until the reader catches up
+    std::thread reader([&]
+                       {
+                           std::array<char, 4096> buffer = {};
+                           ssize_t count = 0;
+                           while ((count = read(pipeEnds[0], buffer.data(), buffer.size())) > 0)
+                           {
+                               received.append(buffer.data(), static_cast<size_t>(count));
+                           } });
+
+    std::array<iovec, 3> segments = {{{first.data(), first.size()}, {second.data(), second.size()}, {third.data(), third.size()}}};
+
+    EXPECT_TRUE(Writer::WriteVector(pipeEnds[1], segments));
+    close(pipeEnds[1]);
+    reader.join();
+    close(pipeEnds[0]);
+
+    EXPECT_EQ(received, first + second + third);
+}
+
+TEST(DecoderTests, SequencesCutBetweenChunks)
+{
+    // Every split position cuts one of the sequences somewhere, octal ones included
+    const string argument = "a\\0101\\012b\\07\\08\\0\\nc\\\\\\td\\xe\\0";
+
+    for (size_t cut = 0; cut <= argument.size(); cut++)
+    {
+        Decoder decoder;
+        string decoded;
+        auto sink = [&decoded](std::string_view piece)
+        { decoded += piece; };
+
+        EXPECT_FALSE(decoder.Feed(std::string_view(argument).substr(0, cut), sink));
+        EXPECT_FALSE(decoder.Feed(std::string_view(argument).substr(cut), sink));
+        EXPECT_FALSE(decoder.Finish(sink));
+        EXPECT_EQ(decoded, Parser::ParseArgument(argument)) << "cut at " << cut;
+    }
+}
+
+TEST(DecoderTests, OneCharacterChunks)
+{
+    const string argument = "Hello\\0101\\tWorld\\041\\cIgnored";
+    Decoder decoder;
+    string decoded;
+    bool stop = false;
+    auto sink = [&decoded](std::string_view piece)
+    { decoded += piece; };
+
+    for (char character : argument)
+    {
+        stop = decoder.Feed(std::string_view(&character, 1), sink) || stop;
+    }
+
+    EXPECT_TRUE(stop);
+    EXPECT_TRUE(decoder.Finish(sink));
+    EXPECT_EQ(decoded, "HelloA\tWorld!");
+}
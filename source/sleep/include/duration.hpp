@@ -0,0 +1,140 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ * Description:
+ * A minimal implementation of the POSIX sleep utility in C++.
+ * This program waits for the specified amound of time, in seconds unless a unit is given.
+ *
+ *  Usage: ./sleep <duration>
+ *
+ *  The duration is a decimal number (e.g. 5, 0.25, .5), optionally followed by a unit:
+ *      ns      : Nanoseconds
+ *      us      : Microseconds
+ *      ms      : Milliseconds
+ *      s       : Seconds (the default)
+ *      m       : Minutes
+ *      h       : Hours
+ *      d       : Days
+ *
+ *  Note: More details on options and behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/sleep.html
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+/**
+ * @brief Number of nanoseconds in a second.
+ */
+inline constexpr std::int64_t NANOSECONDS_PER_SECOND = 1000000000;
+
+/**
+ * @brief Returns the length of a unit of duration in nanoseconds.
+ *
+ * @param unit The unit (e.g., "ms", "h"), empty for seconds.
+ * @return The length of the unit, or 0 if the unit isn't known.
+ */
+constexpr auto unitLength(std::string_view unit) -> std::int64_t
+{
+    constexpr std::int64_t SECONDS_PER_MINUTE = 60;
+    constexpr std::int64_t SECONDS_PER_HOUR   = 3600;
+    constexpr std::int64_t SECONDS_PER_DAY    = 86400;
+
+    if (unit.empty() || unit == "s")
+    {
+        return NANOSECONDS_PER_SECOND;
+    }
+
+    if (unit == "ns")
+    {
+        return 1;
+    }
+
+    if (unit == "us")
+    {
+        return NANOSECONDS_PER_SECOND / 1000000;
+    }
+
+    if (unit == "ms")
+    {
+        return NANOSECONDS_PER_SECOND / 1000;
+    }
+
+    if (unit == "m")
+    {
+        return SECONDS_PER_MINUTE * NANOSECONDS_PER_SECOND;
+    }
+
+    if (unit == "h")
+    {
+        return SECONDS_PER_HOUR * NANOSECONDS_PER_SECOND;
+    }
+
+    return unit == "d" ? SECONDS_PER_DAY * NANOSECONDS_PER_SECOND : 0;
+}
+
+/**
+ * @brief Parses a duration: a decimal number, optionally followed by a unit (see `unitLength()`).
+ *
+ * The number is converted with integers only, so that `0.1` is exactly 100000000 nanoseconds. Digits
+ * beyond the nanosecond are ignored, and a duration longer than the largest number of nanoseconds is
+ * reduced to it (about 292 years).
+ *
+ * @param text The duration (e.g., "5", "0.25", "150ms", "2m", "1.5h").
+ * @return The duration in nanoseconds, or -1 if the text isn't a valid duration.
+ */
+constexpr auto parseDuration(std::string_view text) -> std::int64_t
+{
+    constexpr std::int64_t MAX_DURATION = std::numeric_limits<std::int64_t>::max();
+
+    std::int64_t whole    = 0;                           // Integer part of the number
+    std::int64_t fraction = 0;                           // Fractional part of the number, in billionths
+    std::int64_t scale    = NANOSECONDS_PER_SECOND / 10; // Weight of the next fractional digit, in billionths
+    bool isSaturated      = false;                       // Set once the integer part is too large to be kept
+    bool hasDigits        = false;                       // Set once a digit has been read
+    size_t i              = 0;                           // Position in the text
+
+    for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++)
+    {
+        isSaturated = isSaturated || whole > (MAX_DURATION - 9) / 10;
+        whole       = isSaturated ? MAX_DURATION : whole * 10 + (text[i] - '0');
+        hasDigits   = true;
+    }
+
+    if (i < text.size() && text[i] == '.')
+    {
+        for (i++; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++)
+        {
+            fraction += (text[i] - '0') * scale;
+            scale /= 10;
+            hasDigits = true;
+        }
+    }
+
+    const std::int64_t unit = unitLength(text.substr(i)); // Length of the unit, in nanoseconds
+
+    if (!hasDigits || unit == 0)
+    {
+        return -1;
+    }
+
+    // The fraction is in billionths of the unit: units of a second or more are whole numbers of seconds
+    const std::int64_t fractionLength = unit >= NANOSECONDS_PER_SECOND ? fraction * (unit / NANOSECONDS_PER_SECOND) : fraction * unit / NANOSECONDS_PER_SECOND;
+
+    if (whole > (MAX_DURATION - fractionLength) / unit)
+    {
+        return MAX_DURATION;
+    }
+
+    return whole * unit + fractionLength;
+}
+
+static_assert(parseDuration("0.1") == 100000000 && parseDuration(".5") == 500000000 && parseDuration("5.") == 5000000000, "Seconds");
+static_assert(parseDuration("150ms") == 150000000 && parseDuration("2m") == 120000000000 && parseDuration("1.5h") == 5400000000000, "Units");
+static_assert(parseDuration("") == -1 && parseDuration(".") == -1 && parseDuration("1x") == -1 && parseDuration("-1") == -1, "Invalid durations");
+static_assert(parseDuration("99999999999999999999d") == std::numeric_limits<std::int64_t>::max(), "Long durations are reduced");
@@ -0,0 +1,72 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ * Description:
+ * A minimal implementation of the POSIX sleep utility in C++.
+ * This program waits for the specified amound of time, in seconds unless a unit is given.
+ *
+ *  Usage: ./sleep <duration>
+ *
+ *  The duration is a decimal number (e.g. 5, 0.25, .5), optionally followed by a unit:
+ *      ns      : Nanoseconds
+ *      us      : Microseconds
+ *      ms      : Milliseconds
+ *      s       : Seconds (the default)
+ *      m       : Minutes
+ *      h       : Hours
+ *      d       : Days
+ *
+ *  Note: More details on options and behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/sleep.html
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+
+/**
+ * @class Sleeper
+ * @brief Waits until an absolute deadline of the monotonic clock.
+ *
+ * The deadline is computed once, from the time the wait starts, and `clock_nanosleep()` is given it
+ * as an absolute time (`TIMER_ABSTIME`). A wait interrupted by a signal is resumed with the same deadline,
+ * so interruptions don't add up the time spent handling them, as restarting a relative sleep with the
+ * time left would. Waits following one another on deadlines computed from the same origin don't drift.
+ */
+class Sleeper
+{
+public:
+    /**
+     * @brief Reads the monotonic clock.
+     *
+     * @return The current time of `CLOCK_MONOTONIC`.
+     */
+    static auto Now() -> timespec;
+
+    /**
+     * @brief Computes the deadline a duration after an instant.
+     *
+     * @param origin The instant, read from `Now()`.
+     * @param duration The duration in nanoseconds, non-negative.
+     * @return The deadline.
+     */
+    static auto Deadline(const timespec&, std::int64_t) -> timespec;
+
+    /**
+     * @brief Waits until a deadline of the monotonic clock, resuming the wait after signals.
+     *
+     * @param deadline The deadline, see `Deadline()`. A deadline in the past returns at once.
+     * @return True once the deadline is reached, false if the wait failed (errno is set accordingly).
+     */
+    static auto SleepUntil(const timespec&) -> bool;
+
+    /**
+     * @brief Waits for a duration, from now.
+     *
+     * @param duration The duration in nanoseconds, non-negative.
+     * @return True once the duration has elapsed, false if the wait failed.
+     */
+    static auto Sleep(std::int64_t) -> bool;
+};
@@ -4,35 +4,39 @@
  *
  * Description:
  * A minimal implementation of the POSIX sleep utility in C++.
- * This program waits for the specified amound of time (in second).
+ * This program waits for the specified amound of time, in seconds unless a unit is given.
+ *
+ *  Usage: ./sleep <duration>
+ *
+ *  The duration is a decimal number (e.g. 5, 0.25, .5), optionally followed by a unit:
+ *      ns      : Nanoseconds
+ *      us      : Microseconds
+ *      ms      : Milliseconds
+ *      s       : Seconds (the default)
+ *      m       : Minutes
+ *      h       : Hours
+ *      d       : Days
  *
  *  Note: More details on options and behavior can be found here:
  *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/sleep.html
  */
 
-#include <array>
-#include <chrono>
-#include <csignal>
 #include <cstdlib>
 #include <iostream>
 #include <span>
-#include <string>
-#include <thread>
+#include <string_view>
+
+#include "duration.hpp"
+#include "sleeper.hpp"
 
-using std::array;
 using std::cerr;
-using std::invalid_argument;
+using std::int64_t;
 using std::span;
-using std::stoi;
-using std::string;
-using std::chrono::seconds;
-using std::this_thread::sleep_for;
+using std::string_view;
 
 auto main(int argc, char* argv[]) -> int
 {
     span<char*> args(argv, argc); // Wrap the raw argv array in a std::span for bounds-safe access
-    array<string, 2> arguments;   // Fixed-size array to store the program name and the duration argument
-    seconds duration;             // hold the duration to sleep, expressed in seconds
 
     // Check that exactly one argument (besides the program name) is provided
     if (args.size() != 2)
@@ -41,25 +45,22 @@ auto main(int argc, char* argv[]) -> int
         return EXIT_FAILURE;
     }
 
-    arguments = {args[0], args[1]}; // Store the arguments as std::string for easier manipulation
+    const string_view argument = args[1];                  // The duration, as given
+    const int64_t duration     = parseDuration(argument); // The duration in nanoseconds, -1 if it isn't valid
 
-    try
+    if (duration < 0)
     {
-        duration = seconds(stoi(arguments.at(1))); // Convert the second argument to an integer, then to chrono::seconds
-    }
-    catch (const invalid_argument& e) // The argument is not a valid number
-    {
-        cerr << "Argument is not a numerical value\n";
+        // A leading minus sign is the only way a number can be negative
+        cerr << (argument.starts_with('-') ? "Can't sleep for a negative amount of time\n" : "Argument is not a valid duration (e.g. 5, 0.25, 150ms, 2m)\n");
         return EXIT_FAILURE;
     }
 
-    if (duration.count() < 0) // If the duration is a negative number, exits with a failure
+    // The deadline is computed once on the monotonic clock, so that signals and clock changes don't move it
+    if (!Sleeper::Sleep(duration))
     {
-        cerr << "Can't sleep for a negative amount of time\n";
+        cerr << "Can't sleep\n";
         return EXIT_FAILURE;
     }
 
-    sleep_for(duration); // Pause the program for the given duration
-
     return EXIT_SUCCESS;
 }
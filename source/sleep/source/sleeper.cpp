@@ -0,0 +1,79 @@
+/*
+ *  Copyright (c) 2025, Ludovic Hansen
+ *  License: MIT
+ *
+ * Description:
+ * A minimal implementation of the POSIX sleep utility in C++.
+ * This program waits for the specified amound of time, in seconds unless a unit is given.
+ *
+ *  Usage: ./sleep <duration>
+ *
+ *  The duration is a decimal number (e.g. 5, 0.25, .5), optionally followed by a unit:
+ *      ns      : Nanoseconds
+ *      us      : Microseconds
+ *      ms      : Milliseconds
+ *      s       : Seconds (the default)
+ *      m       : Minutes
+ *      h       : Hours
+ *      d       : Days
+ *
+ *  Note: More details on options and behavior can be found here:
+ *  https://pubs.opengroup.org/onlinepubs/9799919799/utilities/sleep.html
+ */
+
+#include <cerrno>
+#include <cstdint>
+#include <ctime>
+
+#include "duration.hpp"
+#include "sleeper.hpp"
+
+using std::int64_t;
+
+auto Sleeper::Now() -> timespec
+{
+    timespec now = {};
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now;
+}
+
+auto Sleeper::Deadline(const timespec& origin, int64_t duration) -> timespec
+{
+    timespec deadline = origin; // Deadline being computed
+
+    deadline.tv_sec += static_cast<time_t>(duration / NANOSECONDS_PER_SECOND);
+    deadline.tv_nsec += static_cast<long>(duration % NANOSECONDS_PER_SECOND);
+
+    if (deadline.tv_nsec >= NANOSECONDS_PER_SECOND)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= NANOSECONDS_PER_SECOND;
+    }
+
+    return deadline;
+}
+
+auto Sleeper::SleepUntil(const timespec& deadline) -> bool
+{
+    int result = EINTR; // Error returned by clock_nanosleep, which doesn't set errno
+
+    // After a signal, the same deadline is waited for again, whatever the time the handler took
+    while (result == EINTR)
+    {
+        result = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr);
+    }
+
+    if (result != 0)
+    {
+        errno = result;
+    }
+
+    return result == 0;
+}
+
+auto Sleeper::Sleep(int64_t duration) -> bool
+{
+    return SleepUntil(Deadline(Now(), duration));
+}
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <sys/time.h>
+
+#include "duration.hpp"
+#include "sleeper.hpp"
+
+using std::int64_t;
+using std::vector;
+
+namespace
+{
+// Nanoseconds from one instant of the monotonic clock to another
+auto Elapsed(const timespec& from, const timespec& to) -> int64_t
+{
+    return (to.tv_sec - from.tv_sec) * NANOSECONDS_PER_SECOND + (to.tv_nsec - from.tv_nsec);
+}
+} // namespace
+
+TEST(DurationTests, ParsesDecimalsAndUnits)
+{
+    EXPECT_EQ(parseDuration("5"), 5000000000);                             // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseDuration("0.25"), 250000000);                           // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseDuration("0.0000000019"), 1);
+    EXPECT_EQ(parseDuration("150ms"), 150000000);                          // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseDuration("2.5us"), 2500);                               // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseDuration("7ns"), 7);                                    // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseDuration("2m"), 120000000000);                          // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseDuration("0.5d"), 43200000000000);                      // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseDuration("0"), 0);
+    EXPECT_EQ(parseDuration("9223372036.854775807"), 9223372036854775807); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(parseDuration("1e3"), -1);
+
+    for (const char* text : {"", "s", ".", ".s", "-1", "+1", " 1", "1 ", "1..5", "1.5.", "1sm", "1S", "1min"})
+    {
+        EXPECT_EQ(parseDuration(text), -1) << text;
+    }
+}
+
+TEST(SleeperTests, ComputesDeadlines)
+{
+    const timespec deadline = Sleeper::Deadline(timespec{10, 900000000}, 1200000000); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    EXPECT_EQ(deadline.tv_sec, 12);         // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_EQ(deadline.tv_nsec, 100000000); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+TEST(SleeperTests, ShortSleepsDontDrift)
+{
+    constexpr size_t SLEEPS  = 10000;          // Number of sleeps, one after the other
+    constexpr int64_t PERIOD = 100000;         // Time between two deadlines, in nanoseconds
+    const timespec origin    = Sleeper::Now();
+    vector<int64_t> overshoots;                // Time from each deadline to the end of its sleep, in nanoseconds
+
+    overshoots.reserve(SLEEPS);
+
+    // Every deadline is computed from the same origin, as a scheduler pacing its work would
+    for (size_t i = 1; i <= SLEEPS; i++)
+    {
+        const timespec deadline = Sleeper::Deadline(origin, static_cast<int64_t>(i) * PERIOD);
+
+        ASSERT_TRUE(Sleeper::SleepUntil(deadline));
+        overshoots.push_back(Elapsed(deadline, Sleeper::Now()));
+    }
+
+    std::sort(overshoots.begin(), overshoots.end());
+
+    // No sleep ends early, and the overshoots don't add up: the last sleep ends about on its deadline
+    EXPECT_GE(overshoots.front(), 0);
+    EXPECT_LT(overshoots.at(SLEEPS / 2), 2000000);                                                // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    EXPECT_LT(Elapsed(origin, Sleeper::Now()) - static_cast<int64_t>(SLEEPS) * PERIOD, 50000000); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}
+
+TEST(SleeperTests, SignalsDontEndTheSleep)
+{
+    struct sigaction action = {};
+    itimerval timer         = {};
+    const timespec start    = Sleeper::Now();
+
+    // A handler without SA_RESTART makes clock_nanosleep return EINTR on each signal
+    action.sa_handler = [](int /*signal*/) {};
+    sigemptyset(&action.sa_mask);
+    ASSERT_EQ(sigaction(SIGALRM, &action, nullptr), 0);
+
+    timer.it_value.tv_usec    = 1000; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    timer.it_interval.tv_usec = 1000; // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+    ASSERT_EQ(setitimer(ITIMER_REAL, &timer, nullptr), 0);
+
+    EXPECT_TRUE(Sleeper::Sleep(50000000)); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+    timer = {};
+    setitimer(ITIMER_REAL, &timer, nullptr);
+    signal(SIGALRM, SIG_DFL);
+
+    EXPECT_GE(Elapsed(start, Sleeper::Now()), 50000000); // NOLINT(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+}